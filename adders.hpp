@@ -0,0 +1,342 @@
+// File: adders.hpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Header file for the parametric N-bit adder family (ripple-carry, carry-lookahead,
+//              Kogge-Stone and Brent-Kung), built from cHalfAdder/cFullAdder with compile-time wiring.
+
+#ifndef ADDERS_HPP
+#define ADDERS_HPP
+
+#include "circuits.hpp"
+#include "netlist.hpp"
+#include <array>
+#include <cstdint>
+#include <iostream>
+
+//---Structural evaluators------------------------------------------------------
+// An adder describes its wiring once, as a template over an evaluator. The evaluator decides
+// what a signal is and what applying a component means, so the same wiring serves scalar
+// simulation, 64-vector packed simulation and flattening into a cNetlist.
+
+// Scalar three-valued evaluation through the components' own DriveInputs/GetOutputState
+class cScalarEvaluator {
+    public:
+        typedef cLogic::eLogicLevel tSignal;
+
+        void Apply( cLogicGate& aGate, const tSignal* apIn, tSignal* apOut ) {
+            aGate.DriveInputs(apIn, aGate.GetNumInputs());
+            for (int o = 0; o < aGate.GetNumOutputs(); ++o)
+                apOut[o] = aGate.GetOutputState(o);
+        }
+};
+
+// 64 vectors per signal through the components' ComputePacked kernels
+class cPackedEvaluator {
+    public:
+        typedef cLogic::tPackedLevel tSignal;
+
+        void Apply( cLogicGate& aGate, const tSignal* apIn, tSignal* apOut ) {
+            aGate.ComputePacked(apIn, apOut);
+        }
+};
+
+// Signals are net indices; components emit their primitives into a netlist
+class cFlattenEvaluator {
+    public:
+        typedef int tSignal;
+
+        explicit cFlattenEvaluator( cNetlist& aNetlist ) : mNetlist(aNetlist), mOk(true) {}
+
+        void Apply( const cLogicGate& aGate, const tSignal* apIn, tSignal* apOut ) {
+            mOk = aGate.Flatten(mNetlist, apIn, apOut) && mOk;
+        }
+        bool IsOk() const { return mOk; }
+
+    private:
+        cNetlist& mNetlist; // Netlist being built
+        bool mOk;           // Every component flattened successfully
+};
+
+// Applies a two-input, one-output component and returns its output
+template<class tEval, class tGate>
+typename tEval::tSignal ApplyGate( tEval& aEval, tGate& aGate, typename tEval::tSignal aA, typename tEval::tSignal aB ) {
+    typename tEval::tSignal In[2] = { aA, aB };
+    typename tEval::tSignal Out[1];
+    aEval.Apply(aGate, In, Out);
+    return Out[0];
+}
+
+
+//---cAdder---------------------------------------------------------------------
+// Common front end for an N-bit adder with inputs A0..A(N-1), B0..B(N-1) and
+// outputs S0..S(N-1), COUT (the same layout as cThreeBitAdder). tDerived supplies
+// a static Evaluate(self, evaluator, inputs, outputs) describing its wiring.
+template<int N, class tDerived>
+class cAdder : public cSubCircuit {
+    static_assert(N >= 1, "An adder needs at least one bit");
+
+    public:
+        cAdder() : cSubCircuit(/*inputs*/2 * N, /*outputs*/N + 1) {}
+        virtual ~cAdder() {}
+
+        static int InputA( int aBit ) { return aBit; }      // Input index of A[aBit]
+        static int InputB( int aBit ) { return N + aBit; }  // Input index of B[aBit]
+        static int OutputSum( int aBit ) { return aBit; }   // Output index of S[aBit]
+        static int OutputCarry() { return N; }              // Output index of COUT
+
+        void ComputeOutput() override {
+            cScalarEvaluator Eval;
+            cLogic::eLogicLevel Out[N + 1];
+            tDerived::Evaluate(static_cast<tDerived&>(*this), Eval, mInputs.data(), Out);
+            for (int o = 0; o <= N; ++o)
+                SetOutput(o, Out[o]);
+        }
+
+        void ComputePacked( const cLogic::tPackedLevel* apInputs, cLogic::tPackedLevel* apOutputs ) override {
+            cPackedEvaluator Eval;
+            tDerived::Evaluate(static_cast<tDerived&>(*this), Eval, apInputs, apOutputs);
+        }
+
+        bool Flatten( cNetlist& aNetlist, const int* apInputNets, int* apOutputNets ) const override {
+            cFlattenEvaluator Eval(aNetlist);
+            tDerived::Evaluate(static_cast<const tDerived&>(*this), Eval, apInputNets, apOutputNets);
+            return Eval.IsOk();
+        }
+
+        // Checks 64 pseudo-random additions in one packed pass and prints a summary
+        void TestOutputs() override {
+            std::uint64_t Seed = 0x9E3779B97F4A7C15ull;
+            std::uint64_t A[cLogic::PackedWidth], B[cLogic::PackedWidth];
+            cLogic::tPackedLevel In[2 * N] = {};
+            cLogic::tPackedLevel Out[N + 1];
+            for (int v = 0; v < cLogic::PackedWidth; ++v) {
+                Seed ^= Seed << 13; Seed ^= Seed >> 7; Seed ^= Seed << 17; A[v] = Seed;
+                Seed ^= Seed << 13; Seed ^= Seed >> 7; Seed ^= Seed << 17; B[v] = Seed;
+                for (int Bit = 0; Bit < N; ++Bit) {
+                    In[InputA(Bit)] |= cLogic::tPackedLevel((A[v] >> Bit) & 1) << v;
+                    In[InputB(Bit)] |= cLogic::tPackedLevel((B[v] >> Bit) & 1) << v;
+                }
+            }
+            ComputePacked(In, Out);
+
+            int Correct = 0;
+            for (int v = 0; v < cLogic::PackedWidth; ++v) {
+                const std::uint64_t Mask = (N >= 64) ? ~std::uint64_t(0) : ((std::uint64_t(1) << N) - 1);
+                const std::uint64_t a = A[v] & Mask, b = B[v] & Mask;
+                const std::uint64_t Sum = (a + b) & Mask;
+                const int Carry = (N >= 64) ? (a + b < a) : static_cast<int>(((a + b) >> (N % 64)) & 1);
+                bool Ok = ((Out[OutputCarry()] >> v) & 1) == static_cast<cLogic::tPackedLevel>(Carry);
+                for (int Bit = 0; Bit < N; ++Bit)
+                    Ok = Ok && ((Out[OutputSum(Bit)] >> v) & 1) == ((Sum >> Bit) & 1);
+                Correct += Ok;
+            }
+            std::cout << "\nTest Output for " << N << "-bit " << tDerived::GetName() << " Adder\n";
+            std::cout << Correct << "/" << cLogic::PackedWidth << " random additions correct\n";
+        }
+};
+
+
+//---cRippleCarryAdder----------------------------------------------------------
+// Half adder on bit 0, then a chain of N-1 full adders, each taking the previous carry.
+template<int N>
+class cRippleCarryAdder : public cAdder<N, cRippleCarryAdder<N>> {
+    public:
+        static const char* GetName() { return "Ripple-Carry"; }
+
+        template<class tSelf, class tEval>
+        static void Evaluate( tSelf& aSelf, tEval& aEval, const typename tEval::tSignal* apIn, typename tEval::tSignal* apOut ) {
+            typedef typename tEval::tSignal tSignal;
+            tSignal Stage[2];
+
+            tSignal HAIn[2] = { apIn[0], apIn[N] };
+            aEval.Apply(aSelf.mHalfAdder, HAIn, Stage);
+            apOut[0] = Stage[0];
+
+            for (int Bit = 1; Bit < N; ++Bit) {
+                tSignal FAIn[3] = { apIn[Bit], apIn[N + Bit], Stage[1] };
+                aEval.Apply(aSelf.mFullAdders[Bit - 1], FAIn, Stage);
+                apOut[Bit] = Stage[0];
+            }
+            apOut[N] = Stage[1];
+        }
+
+        void ForEachChild( const std::function<void( cLogicGate& aChild, const std::string& aName )>& aVisit ) override {
+            aVisit(mHalfAdder, "ha0");
+            for (int Bit = 1; Bit < N; ++Bit)
+                aVisit(mFullAdders[Bit - 1], "fa" + std::to_string(Bit));
+        }
+
+    private:
+        cHalfAdder mHalfAdder;                                   // Bit 0
+        std::array<cFullAdder, (N > 1 ? N - 1 : 1)> mFullAdders; // Bits 1..N-1
+};
+
+
+//---Prefix networks------------------------------------------------------------
+// The fast adders compute every carry as a prefix over (generate, propagate) pairs.
+// Each network is a compile-time list of cells; cell (i, j) merges the group ending at
+// bit j into the group ending at bit i:  G[i] = G[i] | P[i]&G[j],  P[i] = P[i]&P[j].
+// Cells are listed in an order where every cell reads finished values.
+
+// cPrefixCell: One merge step of a prefix network
+struct cPrefixCell {
+    int mDst;      // Bit whose group grows
+    int mSrc;      // Bit whose group is merged in
+    bool mNeedP;   // Whether the merged P[i] is read by a later cell
+};
+
+// Kogge-Stone: log2(N) levels, every bit merges at every level (minimum depth, maximum cells)
+struct cKoggeStoneNetwork {
+    static const char* GetName() { return "Kogge-Stone"; }
+
+    template<class tVisit>
+    static constexpr void Cells( int aBits, tVisit&& aVisit ) {
+        for (int d = 1; d < aBits; d *= 2)
+            for (int i = aBits - 1; i >= d; --i) // High to low so each level reads the previous one
+                aVisit(i, i - d);
+    }
+};
+
+// Brent-Kung: an up-sweep tree then a down-sweep (about 2N cells, about 2*log2(N) levels)
+struct cBrentKungNetwork {
+    static const char* GetName() { return "Brent-Kung"; }
+
+    template<class tVisit>
+    static constexpr void Cells( int aBits, tVisit&& aVisit ) {
+        int Top = 1;
+        for (int d = 1; 2 * d <= aBits; d *= 2) {
+            for (int i = 2 * d - 1; i < aBits; i += 2 * d)
+                aVisit(i, i - d);
+            Top = d;
+        }
+        for (int d = Top; d >= 1; d /= 2) // Starts at Top so widths that are not a power of two are covered
+            for (int i = 3 * d - 1; i < aBits; i += 2 * d)
+                aVisit(i, i - d);
+    }
+};
+
+// Carry-lookahead in 4-bit blocks: lookahead inside each block, block carries ripple between blocks
+struct cCarryLookaheadNetwork {
+    static const char* GetName() { return "Carry-Lookahead"; }
+    static const int BlockSize = 4;
+
+    template<class tVisit>
+    static constexpr void Cells( int aBits, tVisit&& aVisit ) {
+        // Group generate/propagate within each block (independent of the block carry-in)
+        for (int s = 0; s < aBits; s += BlockSize)
+            for (int i = s + 1; i < s + BlockSize && i < aBits; ++i)
+                aVisit(i, i - 1);
+        // Block carries: the last bit of each block absorbs the previous block's carry
+        for (int s = BlockSize; s < aBits; s += BlockSize) {
+            const int Last = (s + BlockSize - 1 < aBits) ? s + BlockSize - 1 : aBits - 1;
+            aVisit(Last, s - 1);
+        }
+        // Remaining bits of each block take the incoming block carry
+        for (int s = BlockSize; s < aBits; s += BlockSize)
+            for (int i = s; i < s + BlockSize - 1 && i < aBits - 1; ++i)
+                aVisit(i, s - 1);
+    }
+};
+
+// Number of cells a network uses for N bits
+template<int N, class tNetwork>
+constexpr int CountPrefixCells() {
+    int Count = 0;
+    tNetwork::Cells(N, [&Count](int, int) { ++Count; });
+    return Count;
+}
+
+// Cell list of a network for N bits, with the P merges nobody reads marked as unneeded
+template<int N, class tNetwork>
+constexpr std::array<cPrefixCell, CountPrefixCells<N, tNetwork>()> MakePrefixCells() {
+    std::array<cPrefixCell, CountPrefixCells<N, tNetwork>()> Cells{};
+    int Count = 0;
+    tNetwork::Cells(N, [&Cells, &Count](int aDst, int aSrc) {
+        Cells[Count].mDst = aDst;
+        Cells[Count].mSrc = aSrc;
+        Cells[Count].mNeedP = false;
+        ++Count;
+    });
+    for (int c = 0; c < Count; ++c) {
+        for (int Later = c + 1; Later < Count; ++Later) {
+            if (Cells[Later].mDst == Cells[c].mDst || Cells[Later].mSrc == Cells[c].mDst)
+                Cells[c].mNeedP = true;
+        }
+    }
+    return Cells;
+}
+
+
+//---cPrefixAdder---------------------------------------------------------------
+// Half adders form generate (carry) and propagate (sum) per bit, the prefix network
+// turns them into carries with AND/OR gates, and XOR gates form the final sums.
+template<int N, class tNetwork>
+class cPrefixAdder : public cAdder<N, cPrefixAdder<N, tNetwork>> {
+    public:
+        static const char* GetName() { return tNetwork::GetName(); }
+
+        static constexpr int NumCells = CountPrefixCells<N, tNetwork>();
+        static constexpr std::array<cPrefixCell, CountPrefixCells<N, tNetwork>()> Cells = MakePrefixCells<N, tNetwork>();
+
+        template<class tSelf, class tEval>
+        static void Evaluate( tSelf& aSelf, tEval& aEval, const typename tEval::tSignal* apIn, typename tEval::tSignal* apOut ) {
+            typedef typename tEval::tSignal tSignal;
+            tSignal Bit[N][2];   // Per-bit half adder outputs: [0] propagate (sum), [1] generate (carry)
+            tSignal G[N], P[N];  // Group generate/propagate ending at each bit
+
+            for (int i = 0; i < N; ++i) {
+                tSignal HAIn[2] = { apIn[i], apIn[N + i] };
+                aEval.Apply(aSelf.mHalfAdders[i], HAIn, Bit[i]);
+                P[i] = Bit[i][0];
+                G[i] = Bit[i][1];
+            }
+
+            for (int c = 0; c < NumCells; ++c) {
+                const int i = Cells[c].mDst, j = Cells[c].mSrc;
+                const tSignal Carried = ApplyGate(aEval, aSelf.mCarryAnd[c], P[i], G[j]);
+                G[i] = ApplyGate(aEval, aSelf.mCarryOr[c], G[i], Carried);
+                if (Cells[c].mNeedP)
+                    P[i] = ApplyGate(aEval, aSelf.mPropagateAnd[c], P[i], P[j]);
+            }
+
+            // With no carry-in, the carry into bit i is the group generate of bits 0..i-1
+            apOut[0] = Bit[0][0];
+            for (int i = 1; i < N; ++i)
+                apOut[i] = ApplyGate(aEval, aSelf.mSumXor[i - 1], Bit[i][0], G[i - 1]);
+            apOut[N] = G[N - 1];
+        }
+
+        // Components are named by the bit or prefix cell they serve
+        void ForEachChild( const std::function<void( cLogicGate& aChild, const std::string& aName )>& aVisit ) override {
+            for (int i = 0; i < N; ++i)
+                aVisit(mHalfAdders[i], "ha" + std::to_string(i));
+            for (int c = 0; c < NumCells; ++c) {
+                aVisit(mCarryAnd[c], "cell" + std::to_string(c) + "_and");
+                aVisit(mCarryOr[c], "cell" + std::to_string(c) + "_or");
+                if (Cells[c].mNeedP)
+                    aVisit(mPropagateAnd[c], "cell" + std::to_string(c) + "_pand");
+            }
+            for (int i = 1; i < N; ++i)
+                aVisit(mSumXor[i - 1], "xor" + std::to_string(i));
+        }
+
+    private:
+        // Arrays are sized at compile time from the network; size 1 stands in for empty
+        static constexpr int CellSlots = NumCells > 0 ? NumCells : 1;
+
+        std::array<cHalfAdder, N> mHalfAdders;               // Per-bit generate and propagate
+        std::array<cAndGate, CellSlots> mCarryAnd;           // P[i] & G[j] for each cell
+        std::array<cOrGate, CellSlots> mCarryOr;             // G[i] | (P[i] & G[j]) for each cell
+        std::array<cAndGate, CellSlots> mPropagateAnd;       // P[i] & P[j] for each cell that needs it
+        std::array<cXorGate, (N > 1 ? N - 1 : 1)> mSumXor;   // Sum bits 1..N-1
+};
+
+template<int N, class tNetwork>
+constexpr std::array<cPrefixCell, CountPrefixCells<N, tNetwork>()> cPrefixAdder<N, tNetwork>::Cells;
+
+// The adder family, by carry architecture
+template<int N> using cCarryLookaheadAdder = cPrefixAdder<N, cCarryLookaheadNetwork>;
+template<int N> using cKoggeStoneAdder = cPrefixAdder<N, cKoggeStoneNetwork>;
+template<int N> using cBrentKungAdder = cPrefixAdder<N, cBrentKungNetwork>;
+
+#endif // ADDERS_HPP
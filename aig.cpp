@@ -0,0 +1,328 @@
+// File: aig.cpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Implementation file for cAig and cNetlistOptimizer.
+
+//--Includes-------------------------------------------------------------------
+#include "aig.hpp"
+#include "bdd.hpp"
+#include <algorithm>
+#include <utility>
+
+//---cAig Implementation-------------------------------------------------------
+const cAig::tLiteral cAig::False;
+const cAig::tLiteral cAig::True;
+//---
+cAig::cAig() : mNumFolded(0), mNumRewritten(0), mNumShared(0) {
+    Clear();
+}
+//---
+void cAig::Clear() {
+    mNumInputs = 0;
+    mFanin0.assign(1, False);
+    mFanin1.assign(1, False);
+    mOutputs.clear();
+    mHash.clear();
+}
+//---
+cAig::tLiteral cAig::AddInput() {
+    mFanin0.push_back(False);
+    mFanin1.push_back(False);
+    ++mNumInputs;
+    return static_cast<tLiteral>(mFanin0.size() - 1) << 1;
+}
+//---
+void cAig::AddOutput( tLiteral aLiteral ) {
+    mOutputs.push_back(aLiteral);
+}
+//---
+cAig::tLiteral cAig::And( tLiteral aA, tLiteral aB ) {
+    if (aA > aB)
+        std::swap(aA, aB);
+
+    // Constants and trivial cases (False and True are the two smallest literals)
+    if (aA == False || aA == Not(aB)) {
+        ++mNumFolded;
+        return False;
+    }
+    if (aA == True || aA == aB) {
+        ++mNumFolded;
+        return aB;
+    }
+
+    // Two-level rules: look through an operand that is itself an AND
+    for (int Side = 0; Side < 2; ++Side) {
+        const tLiteral X = Side == 0 ? aA : aB;
+        const tLiteral Y = Side == 0 ? aB : aA;
+        if (!IsAnd(GetNode(X)))
+            continue;
+        const tLiteral X0 = mFanin0[GetNode(X)];
+        const tLiteral X1 = mFanin1[GetNode(X)];
+        if (!IsInverted(X)) {
+            if (X0 == Not(Y) || X1 == Not(Y)) {
+                ++mNumRewritten;
+                return False;       // (y' & x1) & y
+            }
+            if (X0 == Y || X1 == Y) {
+                ++mNumRewritten;
+                return X;           // (y & x1) & y
+            }
+        } else {
+            if (X0 == Not(Y) || X1 == Not(Y)) {
+                ++mNumRewritten;
+                return Y;           // !(y' & x1) & y
+            }
+            if (X0 == Y) {
+                ++mNumRewritten;
+                return And(Y, Not(X1)); // !(y & x1) & y == y & !x1
+            }
+            if (X1 == Y) {
+                ++mNumRewritten;
+                return And(Y, Not(X0));
+            }
+        }
+    }
+    if (IsAnd(GetNode(aA)) && IsAnd(GetNode(aB)) && !IsInverted(aA) && !IsInverted(aB)) {
+        const tLiteral A0 = mFanin0[GetNode(aA)], A1 = mFanin1[GetNode(aA)];
+        const tLiteral B0 = mFanin0[GetNode(aB)], B1 = mFanin1[GetNode(aB)];
+        if (A0 == Not(B0) || A0 == Not(B1) || A1 == Not(B0) || A1 == Not(B1)) {
+            ++mNumRewritten;
+            return False;           // (x & a1) & (x' & b1)
+        }
+    }
+
+    // Structural hashing
+    const std::uint64_t Key = (static_cast<std::uint64_t>(aA) << 32) | aB;
+    const std::unordered_map<std::uint64_t, std::uint32_t>::const_iterator Found = mHash.find(Key);
+    if (Found != mHash.end()) {
+        ++mNumShared;
+        return Found->second << 1;
+    }
+    const std::uint32_t Node = static_cast<std::uint32_t>(mFanin0.size());
+    mFanin0.push_back(aA);
+    mFanin1.push_back(aB);
+    mHash.emplace(Key, Node);
+    return Node << 1;
+}
+//---
+cAig::tLiteral cAig::Xor( tLiteral aA, tLiteral aB ) {
+    return And(Not(And(aA, aB)), Not(And(Not(aA), Not(aB))));
+}
+//---
+bool cAig::MatchXor( std::uint32_t aNode, tLiteral& aX, tLiteral& aY ) const {
+    // !(x & y) & !(!x & !y) == x ^ y, in either polarity of x and y
+    const tLiteral F0 = mFanin0[aNode];
+    const tLiteral F1 = mFanin1[aNode];
+    if (!IsInverted(F0) || !IsInverted(F1) || !IsAnd(GetNode(F0)) || !IsAnd(GetNode(F1)))
+        return false;
+    const tLiteral P0 = mFanin0[GetNode(F0)], P1 = mFanin1[GetNode(F0)];
+    const tLiteral Q0 = mFanin0[GetNode(F1)], Q1 = mFanin1[GetNode(F1)];
+    if ((Q0 == Not(P0) && Q1 == Not(P1)) || (Q0 == Not(P1) && Q1 == Not(P0))) {
+        aX = P0;
+        aY = P1;
+        return true;
+    }
+    return false;
+}
+//---
+bool cAig::FromNetlist( const cNetlist& aNetlist ) {
+    Clear();
+    const int NumInputs = aNetlist.GetNumInputs();
+    std::vector<tLiteral> Literals(aNetlist.GetNumNets());
+    for (int i = 0; i < NumInputs; ++i)
+        Literals[i] = AddInput();
+
+    for (int g = 0; g < aNetlist.GetNumGates(); ++g) {
+        const int A = aNetlist.GetInputA(g);
+        const int B = aNetlist.GetInputB(g);
+        const int Out = aNetlist.GetOutputNet(g);
+        if (Out != NumInputs + g || A >= Out || B >= Out)
+            return false; // Not levelized: an input is not yet built
+        const tLiteral LA = A >= 0 ? Literals[A] : False;
+        const tLiteral LB = B >= 0 ? Literals[B] : False;
+        switch (aNetlist.GetOpcode(g)) {
+            case cNetlist::OP_AND:    Literals[Out] = And(LA, LB); break;
+            case cNetlist::OP_OR:     Literals[Out] = Or(LA, LB); break;
+            case cNetlist::OP_XOR:    Literals[Out] = Xor(LA, LB); break;
+            case cNetlist::OP_NAND:   Literals[Out] = Not(And(LA, LB)); break;
+            case cNetlist::OP_NOR:    Literals[Out] = Not(Or(LA, LB)); break;
+            case cNetlist::OP_XNOR:   Literals[Out] = Not(Xor(LA, LB)); break;
+            case cNetlist::OP_NOT:    Literals[Out] = Not(LA); break;
+            case cNetlist::OP_BUF:    Literals[Out] = LA; break;
+            case cNetlist::OP_CONST0: Literals[Out] = False; break;
+            case cNetlist::OP_CONST1: Literals[Out] = True; break;
+        }
+    }
+    for (int o = 0; o < aNetlist.GetNumOutputs(); ++o)
+        AddOutput(Literals[aNetlist.GetOutput(o)]);
+    return true;
+}
+//---
+int cAig::Sweep() {
+    const int Before = GetNumAnds();
+
+    std::vector<std::uint8_t> Reached(mFanin0.size(), 0);
+    for (tLiteral Output : mOutputs)
+        Reached[GetNode(Output)] = 1;
+    for (std::uint32_t n = static_cast<std::uint32_t>(mFanin0.size()); n-- > 0; ) {
+        if (Reached[n] && IsAnd(n))
+            Reached[GetNode(mFanin0[n])] = Reached[GetNode(mFanin1[n])] = 1; // Fanins are always older nodes
+    }
+
+    cAig Rebuilt;
+    std::vector<tLiteral> Map(mFanin0.size(), False);
+    for (int i = 1; i <= mNumInputs; ++i)
+        Map[i] = Rebuilt.AddInput();
+    for (std::uint32_t n = mNumInputs + 1; n < mFanin0.size(); ++n) {
+        if (Reached[n])
+            Map[n] = Rebuilt.And(Map[GetNode(mFanin0[n])] ^ (mFanin0[n] & 1), Map[GetNode(mFanin1[n])] ^ (mFanin1[n] & 1));
+    }
+    for (tLiteral Output : mOutputs)
+        Rebuilt.AddOutput(Map[GetNode(Output)] ^ (Output & 1));
+
+    mFanin0.swap(Rebuilt.mFanin0);
+    mFanin1.swap(Rebuilt.mFanin1);
+    mOutputs.swap(Rebuilt.mOutputs);
+    mHash.swap(Rebuilt.mHash);
+    mNumFolded += Rebuilt.mNumFolded;
+    mNumRewritten += Rebuilt.mNumRewritten;
+    mNumShared += Rebuilt.mNumShared;
+    return Before - GetNumAnds();
+}
+//---
+int cAig::GetDepth() const {
+    std::vector<int> Level(mFanin0.size(), 0);
+    for (std::uint32_t n = mNumInputs + 1; n < mFanin0.size(); ++n)
+        Level[n] = 1 + std::max(Level[GetNode(mFanin0[n])], Level[GetNode(mFanin1[n])]);
+    int Depth = 0;
+    for (tLiteral Output : mOutputs)
+        Depth = std::max(Depth, Level[GetNode(Output)]);
+    return Depth;
+}
+//---
+void cAig::ToNetlist( cNetlist& aNetlist ) const {
+    const std::uint32_t NumNodes = static_cast<std::uint32_t>(mFanin0.size());
+    aNetlist.Clear();
+
+    // Which nodes are emitted, and which are XORs; an XOR needs its operands, not its two inner ANDs
+    std::vector<std::uint8_t> Needed(NumNodes, 0), IsXor(NumNodes, 0);
+    std::vector<tLiteral> XorA(NumNodes), XorB(NumNodes);
+    for (tLiteral Output : mOutputs)
+        Needed[GetNode(Output)] = 1;
+    for (std::uint32_t n = NumNodes; n-- > static_cast<std::uint32_t>(mNumInputs) + 1; ) {
+        if (!Needed[n])
+            continue;
+        if (MatchXor(n, XorA[n], XorB[n])) {
+            IsXor[n] = 1;
+            Needed[GetNode(XorA[n])] = Needed[GetNode(XorB[n])] = 1;
+        } else
+            Needed[GetNode(mFanin0[n])] = Needed[GetNode(mFanin1[n])] = 1;
+    }
+
+    // Choose each node's polarity and gate from the outputs back, so every reader has asked for its
+    // fanins before they are decided. A node is built in the polarity most readers want; an AND node
+    // then reads a & b either directly (AND/NAND) or inverted (NOR/OR), whichever agrees with what its
+    // fanins' other readers want. Inputs only exist plain. XORs accept either polarity of an operand.
+    std::vector<int> Demand(2 * static_cast<size_t>(NumNodes), 0); // Readers wanting each literal
+    std::vector<std::uint8_t> Phase(NumNodes, 0), ReadInverted(NumNodes, 0);
+    for (tLiteral Output : mOutputs)
+        ++Demand[Output];
+    const int Strong = static_cast<int>(NumNodes); // Outweighs any demand
+    const auto Preference = [&]( tLiteral aLiteral ) {
+        if (!IsAnd(GetNode(aLiteral)))
+            return IsInverted(aLiteral) ? -Strong : Strong;
+        return Demand[aLiteral] - Demand[Not(aLiteral)];
+    };
+    for (std::uint32_t n = NumNodes; n-- > static_cast<std::uint32_t>(mNumInputs) + 1; ) {
+        if (!Needed[n])
+            continue;
+        Phase[n] = Demand[2 * n + 1] > Demand[2 * n] ? 1 : 0;
+        if (IsXor[n])
+            continue;
+        const int Direct = Preference(mFanin0[n]) + Preference(mFanin1[n]);
+        ReadInverted[n] = Direct < 0 || (Direct == 0 && IsInverted(mFanin0[n]) && IsInverted(mFanin1[n]));
+        ++Demand[mFanin0[n] ^ ReadInverted[n]];
+        ++Demand[mFanin1[n] ^ ReadInverted[n]];
+    }
+
+    // Net[2n + p] is the net carrying node n in polarity p, -1 until built
+    std::vector<int> Net(2 * static_cast<size_t>(NumNodes), -1);
+    for (int i = 1; i <= mNumInputs; ++i)
+        Net[2 * i] = aNetlist.AddInput();
+    const auto GetNet = [&]( tLiteral aLiteral ) {
+        if (Net[aLiteral] < 0) {
+            if (GetNode(aLiteral) == 0)
+                Net[aLiteral] = aNetlist.AddGate(IsInverted(aLiteral) ? cNetlist::OP_CONST1 : cNetlist::OP_CONST0);
+            else
+                Net[aLiteral] = aNetlist.AddGate(cNetlist::OP_NOT, Net[Not(aLiteral)]);
+        }
+        return Net[aLiteral];
+    };
+
+    for (std::uint32_t n = mNumInputs + 1; n < NumNodes; ++n) {
+        if (!Needed[n])
+            continue;
+        const tLiteral Flip = Phase[n];
+        if (IsXor[n]) {
+            // Take each operand in whichever polarity exists and fold the inversions into XOR/XNOR
+            const tLiteral A = Net[XorA[n]] >= 0 ? XorA[n] : Not(XorA[n]);
+            const tLiteral B = Net[XorB[n]] >= 0 ? XorB[n] : Not(XorB[n]);
+            const tLiteral Parity = (A ^ XorA[n] ^ B ^ XorB[n]) & 1;
+            Net[2 * n + Flip] = aNetlist.AddGate(Parity == Flip ? cNetlist::OP_XOR : cNetlist::OP_XNOR, GetNet(A), GetNet(B));
+            continue;
+        }
+        const tLiteral F0 = mFanin0[n];
+        const tLiteral F1 = mFanin1[n];
+        if (ReadInverted[n])
+            Net[2 * n + Flip] = aNetlist.AddGate(Flip ? cNetlist::OP_OR : cNetlist::OP_NOR, GetNet(Not(F0)), GetNet(Not(F1)));
+        else
+            Net[2 * n + Flip] = aNetlist.AddGate(Flip ? cNetlist::OP_NAND : cNetlist::OP_AND, GetNet(F0), GetNet(F1));
+    }
+
+    for (tLiteral Output : mOutputs)
+        aNetlist.AddOutput(GetNet(Output));
+    aNetlist.Levelize(); // Gates were added in topological order, so this only groups them by level
+}
+
+
+//---cNetlistOptimizer Implementation------------------------------------------
+bool cNetlistOptimizer::Optimize( const cNetlist& aSource, cNetlist& aResult ) {
+    mReport = cReport();
+    mReport.mGatesBefore = aSource.GetNumGates();
+    mReport.mLevelsBefore = aSource.GetNumLevels();
+
+    cAig Aig;
+    if (!Aig.FromNetlist(aSource))
+        return false;
+    const int Built = Aig.GetNumAnds();
+    while (Aig.Sweep() > 0) {} // Each pass can expose more folding to the next; the graph only shrinks
+
+    mReport.mAigNodes = Aig.GetNumAnds();
+    mReport.mDeadNodes = Built - Aig.GetNumAnds();
+    mReport.mFolded = Aig.GetNumFolded();
+    mReport.mRewritten = Aig.GetNumRewritten();
+    mReport.mShared = Aig.GetNumShared();
+
+    // Mapping can lose on circuits already written in good gates; never hand back a larger one
+    cNetlist Mapped;
+    Aig.ToNetlist(Mapped);
+    mReport.mKeptSource = Mapped.GetNumGates() > aSource.GetNumGates()
+                       || (Mapped.GetNumGates() == aSource.GetNumGates() && Mapped.GetNumLevels() >= aSource.GetNumLevels());
+    if (mReport.mKeptSource)
+        aResult = aSource;
+    else
+        aResult = Mapped;
+    mReport.mGatesAfter = aResult.GetNumGates();
+    mReport.mLevelsAfter = aResult.GetNumLevels();
+    return true;
+}
+//---
+bool cNetlistOptimizer::VerifyEquivalent( const cNetlist& aOriginal, const cNetlist& aOptimized, const std::vector<int>& aOrder, std::string* apError ) {
+    cEquivalenceChecker Checker;
+    Checker.SetOrder(aOrder);
+    if (Checker.Check(aOriginal, aOptimized))
+        return true;
+    if (apError != nullptr)
+        *apError = !Checker.GetError().empty() ? Checker.GetError() : "output " + std::to_string(Checker.GetFailingOutput()) + " differs";
+    return false;
+}
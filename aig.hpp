@@ -0,0 +1,104 @@
+// File: aig.hpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Header file for the and-inverter graph (cAig) and the netlist optimization
+//              pass built on it (cNetlistOptimizer).
+
+#ifndef AIG_HPP
+#define AIG_HPP
+
+#include "netlist.hpp"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// cAig is an and-inverter graph: every node is a two-input AND, and inversion is a bit on
+// the edge. A literal is node * 2, plus 1 when inverted; node 0 is constant FALSE and
+// nodes 1..NumInputs are the primary inputs. And() never creates a node it can avoid:
+//  - constants and trivial cases fold (a & 1 = a, a & !a = 0, ...)
+//  - two-level rules rewrite across one AND fanin (a & (!a & b) = 0, a & !(a & b) = a & !b, ...)
+//  - structural hashing returns the existing node for the same fanin pair
+// so building a circuit in the graph already shares duplicate logic.
+class cAig {
+    public:
+        typedef std::uint32_t tLiteral;
+        static const tLiteral False = 0;
+        static const tLiteral True = 1;
+
+        cAig(); // Just the constant node
+
+        tLiteral AddInput(); // Adds a primary input (only before the first And)
+        tLiteral And( tLiteral aA, tLiteral aB );
+        tLiteral Or( tLiteral aA, tLiteral aB ) { return Not(And(Not(aA), Not(aB))); }
+        tLiteral Xor( tLiteral aA, tLiteral aB ); // Built as (a | b) & !(a & b), sharing a & b with any half adder carry
+        static tLiteral Not( tLiteral aA ) { return aA ^ 1; }
+        void AddOutput( tLiteral aLiteral ); // Marks a literal as the next primary output
+
+        bool FromNetlist( const cNetlist& aNetlist ); // Replaces the graph with a levelized netlist's logic; false if it is not levelized
+        void ToNetlist( cNetlist& aNetlist ) const; // Maps the graph back to primitive gates, levelized; only logic reaching an output is emitted
+        int Sweep(); // Rebuilds the graph from the outputs, dropping unreachable nodes and applying rules enabled by earlier folding; returns nodes removed
+
+        int GetNumInputs() const { return mNumInputs; }
+        int GetNumOutputs() const { return static_cast<int>(mOutputs.size()); }
+        int GetNumAnds() const { return static_cast<int>(mFanin0.size()) - 1 - mNumInputs; }
+        int GetDepth() const; // AND nodes on the longest input to output path
+
+        // Counts since construction
+        long long GetNumFolded() const { return mNumFolded; }       // And() calls answered by a constant or an operand
+        long long GetNumRewritten() const { return mNumRewritten; } // Two-level rewrites applied
+        long long GetNumShared() const { return mNumShared; }       // Structural hashing hits
+
+    private:
+        static std::uint32_t GetNode( tLiteral aLiteral ) { return aLiteral >> 1; }
+        static bool IsInverted( tLiteral aLiteral ) { return aLiteral & 1; }
+        bool IsAnd( std::uint32_t aNode ) const { return aNode > static_cast<std::uint32_t>(mNumInputs); }
+        bool MatchXor( std::uint32_t aNode, tLiteral& aX, tLiteral& aY ) const; // Node computes aX ^ aY in the shape Xor builds
+        void Clear(); // Back to just the constant node
+
+        int mNumInputs;                                         // Primary inputs
+        std::vector<tLiteral> mFanin0;                          // First fanin of each node (unused below the first AND)
+        std::vector<tLiteral> mFanin1;                          // Second fanin, never smaller than the first
+        std::vector<tLiteral> mOutputs;                         // Literal of each primary output
+        std::unordered_map<std::uint64_t, std::uint32_t> mHash; // Fanin pair to node, for structural hashing
+        long long mNumFolded;                                   // See GetNumFolded
+        long long mNumRewritten;                                // See GetNumRewritten
+        long long mNumShared;                                   // See GetNumShared
+};
+
+
+// cNetlistOptimizer shrinks a compiled netlist: it converts it to an AIG (folding constants,
+// sharing duplicates and rewriting on the way in), sweeps logic no output depends on, and maps
+// the graph back to the primitive gates, recovering XOR/XNOR and NAND/NOR/OR where they save
+// inverters. The result computes the same outputs from the same inputs; cEquivalenceChecker
+// (bdd.hpp) proves that for a given circuit, as VerifyEquivalent does.
+class cNetlistOptimizer {
+    public:
+        // cReport: What one Optimize call achieved
+        class cReport {
+            public:
+                int mGatesBefore;       // Gates in the source netlist
+                int mGatesAfter;        // Gates in the result
+                int mLevelsBefore;      // Logic depth of the source
+                int mLevelsAfter;       // Logic depth of the result
+                int mAigNodes;          // AND nodes after sweeping
+                int mDeadNodes;         // AND nodes swept as unreachable or redundant
+                long long mFolded;      // See cAig::GetNumFolded
+                long long mRewritten;   // See cAig::GetNumRewritten
+                long long mShared;      // See cAig::GetNumShared
+                bool mKeptSource;       // The mapped graph was no smaller, so the result is a copy of the source
+        };
+
+        cNetlistOptimizer() : mReport() {}
+
+        bool Optimize( const cNetlist& aSource, cNetlist& aResult ); // Never larger than aSource; false if aSource is not levelized
+        const cReport& GetReport() const { return mReport; }
+
+        // BDD proof that aOptimized matches aOriginal; aOrder as cEquivalenceChecker::SetOrder (empty: input order)
+        static bool VerifyEquivalent( const cNetlist& aOriginal, const cNetlist& aOptimized, const std::vector<int>& aOrder, std::string* apError = nullptr );
+
+    private:
+        cReport mReport;        // See GetReport
+};
+
+#endif // AIG_HPP
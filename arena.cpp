@@ -0,0 +1,78 @@
+// File: arena.cpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Implementation file for cNetlistArena.
+
+//--Includes-------------------------------------------------------------------
+#include "arena.hpp"
+#include <cstdint>
+
+//---cNetlistArena Implementation----------------------------------------------
+cNetlistArena::cNetlistArena( size_t aBlockBytes )
+    : mBlockBytes(aBlockBytes),
+      mpCursor(nullptr),
+      mpLimit(nullptr),
+      mpDestructors(nullptr),
+      mBytesUsed(0),
+      mBytesReserved(0),
+      mNumObjects(0) {}
+//---
+cNetlistArena::~cNetlistArena() {
+    Release();
+}
+//---
+void* cNetlistArena::Allocate( size_t aBytes, size_t aAlignment ) {
+    std::uintptr_t Address = reinterpret_cast<std::uintptr_t>(mpCursor);
+    size_t Padding = (aAlignment - Address % aAlignment) % aAlignment;
+
+    if (mpCursor == nullptr || Padding + aBytes > static_cast<size_t>(mpLimit - mpCursor)) {
+        AddBlock(aBytes + aAlignment); // Oversized requests get a block of their own
+        Address = reinterpret_cast<std::uintptr_t>(mpCursor);
+        Padding = (aAlignment - Address % aAlignment) % aAlignment;
+    }
+
+    char* pResult = mpCursor + Padding;
+    mpCursor = pResult + aBytes;
+    mBytesUsed += Padding + aBytes;
+    return pResult;
+}
+//---
+void cNetlistArena::AddBlock( size_t aMinBytes ) {
+    const size_t Bytes = aMinBytes > mBlockBytes ? aMinBytes : mBlockBytes;
+    char* pBlock = static_cast<char*>(::operator new(Bytes));
+    mBlocks.push_back(pBlock);
+    mpCursor = pBlock;
+    mpLimit = pBlock + Bytes;
+    mBytesReserved += Bytes;
+}
+//---
+void cNetlistArena::AddDestructor( void* apObject, tDestroy apDestroy ) {
+    if (mpDestructors == nullptr || mpDestructors->mCount == cDestructorChunk::Capacity) {
+        cDestructorChunk* pChunk = static_cast<cDestructorChunk*>(Allocate(sizeof(cDestructorChunk), alignof(cDestructorChunk)));
+        pChunk->mpPrevious = mpDestructors;
+        pChunk->mCount = 0;
+        mpDestructors = pChunk;
+    }
+    mpDestructors->mpObjects[mpDestructors->mCount] = apObject;
+    mpDestructors->mpDestroy[mpDestructors->mCount] = apDestroy;
+    ++mpDestructors->mCount;
+}
+//---
+void cNetlistArena::Release() {
+    // Reverse order, so an object may still use anything created before it while being destroyed
+    for (cDestructorChunk* pChunk = mpDestructors; pChunk != nullptr; pChunk = pChunk->mpPrevious) {
+        for (int i = pChunk->mCount; i-- > 0; )
+            pChunk->mpDestroy[i](pChunk->mpObjects[i]);
+    }
+    mpDestructors = nullptr;
+
+    for (char* pBlock : mBlocks)
+        ::operator delete(pBlock);
+    mBlocks.clear();
+
+    mpCursor = nullptr;
+    mpLimit = nullptr;
+    mBytesUsed = 0;
+    mBytesReserved = 0;
+    mNumObjects = 0;
+}
@@ -0,0 +1,76 @@
+// File: arena.hpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Header file for cNetlistArena, a bulk allocator for gates and wires.
+
+#ifndef ARENA_HPP
+#define ARENA_HPP
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// cNetlistArena hands out objects from large contiguous blocks instead of one heap
+// allocation each, so a circuit's gates and wires sit next to each other in memory.
+// Objects cannot be freed individually: Release (or the destructor) destroys every
+// object in reverse order of creation and returns all blocks in one step.
+class cNetlistArena {
+    public:
+        static const size_t DefaultBlockBytes = 256 * 1024; // Size of each block taken from the heap
+
+        explicit cNetlistArena( size_t aBlockBytes = DefaultBlockBytes ); // Constructor
+        ~cNetlistArena(); // Destroys every object and frees every block
+        cNetlistArena( const cNetlistArena& ) = delete;            // Objects are referenced by address
+        cNetlistArena& operator=( const cNetlistArena& ) = delete;
+
+        // Constructs a tType in the arena; it lives until Release
+        template<class tType, class... tArgs>
+        tType* Create( tArgs&&... aArgs ) {
+            void* pMemory = Allocate(sizeof(tType), alignof(tType));
+            tType* pObject = new (pMemory) tType(std::forward<tArgs>(aArgs)...);
+            if (!std::is_trivially_destructible<tType>::value)
+                AddDestructor(pObject, &Destroy<tType>);
+            ++mNumObjects;
+            return pObject;
+        }
+
+        void* Allocate( size_t aBytes, size_t aAlignment ); // Raw aligned storage, never individually freed
+        void Release(); // Destroys every object and frees every block
+
+        size_t GetBytesUsed() const { return mBytesUsed; }         // Bytes handed out, including alignment padding
+        size_t GetBytesReserved() const { return mBytesReserved; } // Bytes taken from the heap
+        size_t GetNumObjects() const { return mNumObjects; }       // Objects created since the last Release
+
+    private:
+        typedef void (*tDestroy)( void* );
+
+        // cDestructorChunk: Type-erased destructor calls, kept in the arena itself so
+        // registering one never reallocates; chunks are chained newest first
+        class cDestructorChunk {
+            public:
+                static const int Capacity = 255;
+                cDestructorChunk* mpPrevious;       // Older chunk, or nullptr
+                int mCount;                         // Entries in use
+                void* mpObjects[Capacity];          // Objects to destroy
+                tDestroy mpDestroy[Capacity];       // Runs each object's destructor
+        };
+
+        template<class tType>
+        static void Destroy( void* apObject ) { static_cast<tType*>(apObject)->~tType(); }
+
+        void AddBlock( size_t aMinBytes ); // Starts a new block of at least aMinBytes
+        void AddDestructor( void* apObject, tDestroy apDestroy ); // Records an object for Release
+
+        size_t mBlockBytes;                     // Size of a normal block
+        std::vector<char*> mBlocks;             // Every block taken from the heap
+        char* mpCursor;                         // Next free byte in the current block
+        char* mpLimit;                          // End of the current block
+        cDestructorChunk* mpDestructors;        // Newest chunk of objects needing destruction
+        size_t mBytesUsed;                      // See GetBytesUsed
+        size_t mBytesReserved;                  // See GetBytesReserved
+        size_t mNumObjects;                     // See GetNumObjects
+};
+
+#endif // ARENA_HPP
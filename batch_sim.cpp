@@ -0,0 +1,307 @@
+// File: batch_sim.cpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Implementation file for cBatchSimulator.
+
+//--Includes-------------------------------------------------------------------
+#include "batch_sim.hpp"
+#include "adders.hpp"
+#include "circuits.hpp"
+#include "netlist_reader.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <memory>
+#include <unistd.h>
+
+//---Local helpers-------------------------------------------------------------
+namespace {
+
+template<class tGate>
+std::unique_ptr<cLogicGate> MakeCircuit() {
+    return std::unique_ptr<cLogicGate>(new tGate);
+}
+
+// cBuiltinCircuit: A circuit selectable by name
+class cBuiltinCircuit {
+    public:
+        const char* mpName;                       // Name given on the command line
+        std::unique_ptr<cLogicGate> (*mpMake)();  // Creates the circuit
+};
+
+const cBuiltinCircuit BuiltinCircuits[] = {
+    { "and", &MakeCircuit<cAndGate> },
+    { "or", &MakeCircuit<cOrGate> },
+    { "xor", &MakeCircuit<cXorGate> },
+    { "nand", &MakeCircuit<cNandGate> },
+    { "nor", &MakeCircuit<cNorGate> },
+    { "xnor", &MakeCircuit<cXnorGate> },
+    { "not", &MakeCircuit<cNotGate> },
+    { "buf", &MakeCircuit<cBufGate> },
+    { "half_adder", &MakeCircuit<cHalfAdder> },
+    { "full_adder", &MakeCircuit<cFullAdder> },
+    { "three_bit_adder", &MakeCircuit<cThreeBitAdder> },
+    { "rca8", &MakeCircuit<cRippleCarryAdder<8>> },
+    { "rca16", &MakeCircuit<cRippleCarryAdder<16>> },
+    { "rca32", &MakeCircuit<cRippleCarryAdder<32>> },
+    { "rca64", &MakeCircuit<cRippleCarryAdder<64>> },
+    { "cla64", &MakeCircuit<cCarryLookaheadAdder<64>> },
+    { "ks64", &MakeCircuit<cKoggeStoneAdder<64>> },
+    { "bk64", &MakeCircuit<cBrentKungAdder<64>> }
+};
+
+const size_t WordBytes = sizeof(cLogic::tPackedLevel);
+
+cLogic::tPackedLevel LoadWord( const char* apBytes ) {
+    cLogic::tPackedLevel Word = 0;
+    for (size_t b = 0; b < WordBytes; ++b)
+        Word |= cLogic::tPackedLevel(static_cast<unsigned char>(apBytes[b])) << (8 * b);
+    return Word;
+}
+
+void StoreWord( char* apBytes, cLogic::tPackedLevel aWord ) {
+    for (size_t b = 0; b < WordBytes; ++b)
+        apBytes[b] = static_cast<char>((aWord >> (8 * b)) & 0xFF);
+}
+
+} // namespace
+
+
+//---cBatchSimulator Implementation--------------------------------------------
+const size_t cBatchSimulator::BufferBytes;
+//---
+cBatchSimulator::cBatchSimulator()
+    : mInputBegin(0),
+      mInputEnd(0),
+      mInputDone(false),
+      mInputFile(-1),
+      mLine(0),
+      mOutputUsed(0),
+      mOutputFile(-1),
+      mOutputFailed(false),
+      mNumVectors(0) {}
+//---
+std::string cBatchSimulator::GetCircuitNames() {
+    std::string Names;
+    for (const cBuiltinCircuit& Circuit : BuiltinCircuits)
+        Names += (Names.empty() ? "" : " ") + std::string(Circuit.mpName);
+    return Names;
+}
+//---
+bool cBatchSimulator::SetCircuit( const char* apName ) {
+    mError.clear();
+    for (const cBuiltinCircuit& Circuit : BuiltinCircuits) {
+        if (std::strcmp(Circuit.mpName, apName) == 0) {
+            if (!mNetlist.Compile(*Circuit.mpMake()))
+                return Fail(std::string("cannot compile ") + apName);
+            return true;
+        }
+    }
+
+    std::string Error;
+    if (!cNetlistReader::LoadCompiled(apName, mNetlist, &Error))
+        return Fail(std::string(apName) + ": " + (Error.empty() ? "not a known circuit or netlist" : Error));
+    return true;
+}
+//---
+bool cBatchSimulator::Optimize() {
+    mError.clear();
+    if (!mOptimizer.Optimize(mNetlist, mNetlist))
+        return Fail("circuit is not levelized");
+    return true;
+}
+//---
+bool cBatchSimulator::Run( int aInputFile, int aOutputFile, eFormat aInputFormat, eFormat aOutputFormat ) {
+    const int NumInputs = mNetlist.GetNumInputs();
+    const int NumOutputs = mNetlist.GetNumOutputs();
+    mError.clear();
+    mNumVectors = 0;
+    if (NumInputs == 0)
+        return Fail("circuit has no inputs");
+
+    BeginInput(aInputFile);
+    mOutput.assign(std::max(BufferBytes, cLogic::PackedWidth * (NumOutputs + 1 + WordBytes)), 0);
+    mOutputUsed = 0;
+    mOutputFile = aOutputFile;
+    mOutputFailed = false;
+
+    std::vector<cLogic::tPackedLevel> In(NumInputs), Out(NumOutputs);
+    while (mError.empty()) {
+        const int Count = aInputFormat == FORMAT_TEXT ? ReadText(In.data()) : ReadBinary(In.data());
+        if (Count == 0)
+            break;
+
+        mNetlist.EvaluatePacked(In.data(), Out.data(), mNets);
+        mNumVectors += Count;
+        if (aOutputFormat == FORMAT_TEXT)
+            WriteText(Out.data(), Count);
+        else
+            WriteBinary(Out.data());
+    }
+
+    Flush();
+    return mError.empty();
+}
+//---
+bool cBatchSimulator::Grade( int aInputFile, eFormat aInputFormat, cFaultSimulator& aFaults ) {
+    mError.clear();
+    mNumVectors = 0;
+    if (mNetlist.GetNumInputs() == 0)
+        return Fail("circuit has no inputs");
+
+    BeginInput(aInputFile);
+    std::vector<cLogic::tPackedLevel> In(mNetlist.GetNumInputs());
+    while (mError.empty()) {
+        const int Count = aInputFormat == FORMAT_TEXT ? ReadText(In.data()) : ReadBinary(In.data());
+        if (Count <= 0)
+            break;
+        aFaults.Simulate(In.data(), Count);
+        mNumVectors += Count;
+    }
+    return mError.empty();
+}
+//---
+void cBatchSimulator::BeginInput( int aInputFile ) {
+    // A buffer always holds at least two binary blocks, so a block never straddles a refill twice
+    mInput.assign(std::max(BufferBytes, 2 * mNetlist.GetNumInputs() * WordBytes), 0);
+    mInputBegin = mInputEnd = 0;
+    mInputDone = false;
+    mInputFile = aInputFile;
+    mLine = 0;
+}
+//---
+bool cBatchSimulator::Fill() {
+    if (mInputBegin > 0) {
+        std::memmove(mInput.data(), mInput.data() + mInputBegin, mInputEnd - mInputBegin);
+        mInputEnd -= mInputBegin;
+        mInputBegin = 0;
+    }
+
+    while (!mInputDone) {
+        const ssize_t Read = read(mInputFile, mInput.data() + mInputEnd, mInput.size() - mInputEnd);
+        if (Read > 0) {
+            mInputEnd += static_cast<size_t>(Read);
+            return true;
+        }
+        if (Read < 0 && errno == EINTR)
+            continue;
+        if (Read < 0)
+            Fail(std::string("cannot read stimulus: ") + std::strerror(errno));
+        mInputDone = true;
+    }
+    return false;
+}
+//---
+int cBatchSimulator::ReadText( cLogic::tPackedLevel* apInputs ) {
+    const int NumInputs = mNetlist.GetNumInputs();
+    std::fill(apInputs, apInputs + NumInputs, 0);
+
+    int Count = 0;
+    while (Count < cLogic::PackedWidth) {
+        const char* pLine = mInput.data() + mInputBegin;
+        const char* pEnd = static_cast<const char*>(std::memchr(pLine, '\n', mInputEnd - mInputBegin));
+        if (pEnd == nullptr) {
+            if (!mInputDone) {
+                if (mInputBegin == 0 && mInputEnd == mInput.size()) {
+                    Fail("line " + std::to_string(mLine + 1) + ": line is longer than the input buffer");
+                    break;
+                }
+                Fill();
+                continue;
+            }
+            if (mInputBegin == mInputEnd)
+                break; // End of input
+            pEnd = mInput.data() + mInputEnd; // Last line has no newline
+        }
+        mInputBegin = std::min(static_cast<size_t>(pEnd - mInput.data()) + 1, mInputEnd);
+        ++mLine;
+
+        int Bit = 0;
+        for (const char* pChar = pLine; pChar != pEnd && *pChar != '#'; ++pChar) {
+            const unsigned Digit = static_cast<unsigned char>(*pChar) - '0';
+            if (Digit <= 1) {
+                if (Bit < NumInputs)
+                    apInputs[Bit] |= cLogic::tPackedLevel(Digit) << Count; // No branch on the value: stimulus bits are unpredictable
+                ++Bit;
+            } else if (*pChar != ' ' && *pChar != '\t' && *pChar != '\r') {
+                Fail("line " + std::to_string(mLine) + ": unexpected character '" + *pChar + "'");
+                return Count;
+            }
+        }
+        if (Bit == 0)
+            continue; // Blank or comment line
+        if (Bit != NumInputs) {
+            Fail("line " + std::to_string(mLine) + ": expected " + std::to_string(NumInputs) + " input values, found " + std::to_string(Bit));
+            return Count;
+        }
+        ++Count;
+    }
+    return Count;
+}
+//---
+int cBatchSimulator::ReadBinary( cLogic::tPackedLevel* apInputs ) {
+    const int NumInputs = mNetlist.GetNumInputs();
+    const size_t BlockBytes = NumInputs * WordBytes;
+
+    while (mInputEnd - mInputBegin < BlockBytes) {
+        if (mInputDone || !Fill()) {
+            if (mInputEnd != mInputBegin)
+                Fail("stimulus ends part way through a block (" + std::to_string(mInputEnd - mInputBegin) + " of " + std::to_string(BlockBytes) + " bytes)");
+            return 0;
+        }
+    }
+
+    const char* pBlock = mInput.data() + mInputBegin;
+    for (int i = 0; i < NumInputs; ++i)
+        apInputs[i] = LoadWord(pBlock + i * WordBytes);
+    mInputBegin += BlockBytes;
+    return cLogic::PackedWidth;
+}
+//---
+void cBatchSimulator::WriteText( const cLogic::tPackedLevel* apOutputs, int aNumVectors ) {
+    const int NumOutputs = mNetlist.GetNumOutputs();
+    char* pOut = Reserve(static_cast<size_t>(aNumVectors) * (NumOutputs + 1));
+    for (int v = 0; v < aNumVectors; ++v) {
+        for (int o = 0; o < NumOutputs; ++o)
+            *pOut++ = static_cast<char>('0' + ((apOutputs[o] >> v) & 1));
+        *pOut++ = '\n';
+    }
+}
+//---
+void cBatchSimulator::WriteBinary( const cLogic::tPackedLevel* apOutputs ) {
+    const int NumOutputs = mNetlist.GetNumOutputs();
+    char* pOut = Reserve(NumOutputs * WordBytes);
+    for (int o = 0; o < NumOutputs; ++o)
+        StoreWord(pOut + o * WordBytes, apOutputs[o]);
+}
+//---
+char* cBatchSimulator::Reserve( size_t aBytes ) {
+    if (mOutputUsed + aBytes > mOutput.size())
+        Flush();
+    char* pSpace = mOutput.data() + mOutputUsed;
+    mOutputUsed += aBytes;
+    return pSpace;
+}
+//---
+bool cBatchSimulator::Flush() {
+    size_t Written = 0;
+    while (Written < mOutputUsed && !mOutputFailed) {
+        const ssize_t Count = write(mOutputFile, mOutput.data() + Written, mOutputUsed - Written);
+        if (Count > 0)
+            Written += static_cast<size_t>(Count);
+        else if (Count < 0 && errno == EINTR)
+            continue;
+        else {
+            Fail(std::string("cannot write responses: ") + std::strerror(errno));
+            mOutputFailed = true;
+        }
+    }
+    mOutputUsed = 0;
+    return !mOutputFailed;
+}
+//---
+bool cBatchSimulator::Fail( const std::string& aMessage ) {
+    if (mError.empty())
+        mError = aMessage; // Keep the first error; later ones are usually consequences
+    return false;
+}
@@ -0,0 +1,80 @@
+// File: batch_sim.hpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Header file for cBatchSimulator, which streams stimulus vectors through a circuit.
+
+#ifndef BATCH_SIM_HPP
+#define BATCH_SIM_HPP
+
+#include "aig.hpp"
+#include "fault_sim.hpp"
+#include "netlist.hpp"
+#include <string>
+#include <vector>
+
+// cBatchSimulator streams stimulus vectors from a file descriptor through one compiled
+// circuit and writes the responses to another. Vectors are evaluated 64 at a time with
+// cNetlist::EvaluatePacked; input and output go through fixed buffers with one read or
+// write system call per buffer, so memory use does not grow with the number of vectors.
+//
+// Text format: one vector per line, a '0' or '1' per input with input 0 first. Blank
+// space is ignored and '#' starts a comment. Responses are a '0' or '1' per output.
+// Binary format: blocks of 64 vectors, one little-endian 64-bit word per input (per output
+// for responses), bit v of a word carrying vector v. Text input written as binary is
+// padded to a whole block with all-zero vectors.
+class cBatchSimulator {
+    public:
+        // eFormat: Stimulus or response encoding
+        enum eFormat {
+            FORMAT_TEXT,    // '0'/'1' characters, one vector per line
+            FORMAT_BINARY   // Packed 64-vector blocks
+        };
+
+        static const size_t BufferBytes = 1 << 20; // Size of each of the input and output buffers
+
+        cBatchSimulator(); // Constructor
+        ~cBatchSimulator() {}
+
+        bool SetCircuit( const char* apName ); // Selects a built-in circuit by name, or loads a .bench/.blif netlist
+        bool Optimize(); // Replaces the circuit with cNetlistOptimizer's result; false if it could not run
+        bool Run( int aInputFile, int aOutputFile, eFormat aInputFormat, eFormat aOutputFormat ); // Streams until end of input; false on a malformed stimulus or I/O error
+        bool Grade( int aInputFile, eFormat aInputFormat, cFaultSimulator& aFaults ); // Streams the stimulus through aFaults (built on GetNetlist) instead of writing responses
+
+        const cNetlist& GetNetlist() const { return mNetlist; }
+        const cNetlistOptimizer::cReport& GetOptimizeReport() const { return mOptimizer.GetReport(); } // What the last Optimize removed
+        long long GetNumVectors() const { return mNumVectors; } // Vectors simulated by the last Run
+        const std::string& GetError() const { return mError; }  // Reason SetCircuit or Run failed
+        static std::string GetCircuitNames(); // Built-in circuits, separated by spaces
+
+    private:
+        void BeginInput( int aInputFile ); // Resets the input buffer to read aInputFile
+        int ReadText( cLogic::tPackedLevel* apInputs ); // Up to 64 vectors; returns the count, -1 on error
+        int ReadBinary( cLogic::tPackedLevel* apInputs ); // One block; returns 64, 0 at end, -1 on error
+        bool Fill(); // Moves unread input to the front of the buffer and reads more; false at end of input
+        void WriteText( const cLogic::tPackedLevel* apOutputs, int aNumVectors );
+        void WriteBinary( const cLogic::tPackedLevel* apOutputs );
+        char* Reserve( size_t aBytes ); // Room for aBytes more output, flushing first if needed
+        bool Flush(); // Writes out the buffered responses
+        bool Fail( const std::string& aMessage ); // Records an error and returns false
+
+        cNetlist mNetlist;                          // Circuit being simulated
+        std::vector<cLogic::tPackedLevel> mNets;    // Scratch net values for EvaluatePacked
+        cNetlistOptimizer mOptimizer;               // Optimizes mNetlist on request
+
+        std::vector<char> mInput;   // Input buffer
+        size_t mInputBegin;         // First unread byte of mInput
+        size_t mInputEnd;           // One past the last byte read into mInput
+        bool mInputDone;            // The input file reached end of file
+        int mInputFile;             // Descriptor being read
+        long long mLine;            // Text line being parsed, for error messages
+
+        std::vector<char> mOutput;  // Output buffer
+        size_t mOutputUsed;         // Bytes of mOutput waiting to be written
+        int mOutputFile;            // Descriptor being written
+        bool mOutputFailed;         // A write failed; later output is discarded
+
+        long long mNumVectors;      // See GetNumVectors
+        std::string mError;         // See GetError
+};
+
+#endif // BATCH_SIM_HPP
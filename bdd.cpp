@@ -0,0 +1,485 @@
+// File: bdd.cpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Implementation file for cBdd, cBddManager and cEquivalenceChecker.
+
+//--Includes-------------------------------------------------------------------
+#include "bdd.hpp"
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+#include <utility>
+
+//---Local helpers-------------------------------------------------------------
+namespace {
+
+const size_t InitialBuckets = size_t(1) << 16;
+const size_t InitialGcThreshold = size_t(1) << 20;
+
+size_t Mix( std::uint64_t aA, std::uint64_t aB, std::uint64_t aC ) {
+    std::uint64_t Hash = aA * 0x9E3779B97F4A7C15ull ^ aB * 0xC2B2AE3D27D4EB4Full ^ aC * 0x165667B19E3779F9ull;
+    Hash ^= Hash >> 29;
+    return static_cast<size_t>(Hash * 0xBF58476D1CE4E5B9ull >> 17);
+}
+
+} // namespace
+
+
+//---cBdd Implementation-------------------------------------------------------
+cBdd::cBdd( cBddManager* apManager, std::uint32_t aEdge ) : mpManager(apManager), mEdge(aEdge) {
+    mpManager->AddRef(mEdge);
+}
+//---
+cBdd::cBdd( const cBdd& aOther ) : mpManager(aOther.mpManager), mEdge(aOther.mEdge) {
+    if (mpManager != nullptr)
+        mpManager->AddRef(mEdge);
+}
+//---
+cBdd::cBdd( cBdd&& aOther ) noexcept : mpManager(aOther.mpManager), mEdge(aOther.mEdge) {
+    aOther.mpManager = nullptr;
+}
+//---
+cBdd& cBdd::operator=( const cBdd& aOther ) {
+    if (aOther.mpManager != nullptr)
+        aOther.mpManager->AddRef(aOther.mEdge); // Before releasing, in case both are the same node
+    if (mpManager != nullptr)
+        mpManager->Release(mEdge);
+    mpManager = aOther.mpManager;
+    mEdge = aOther.mEdge;
+    return *this;
+}
+//---
+cBdd& cBdd::operator=( cBdd&& aOther ) noexcept {
+    if (this != &aOther) {
+        if (mpManager != nullptr)
+            mpManager->Release(mEdge);
+        mpManager = aOther.mpManager;
+        mEdge = aOther.mEdge;
+        aOther.mpManager = nullptr;
+    }
+    return *this;
+}
+//---
+cBdd::~cBdd() {
+    if (mpManager != nullptr)
+        mpManager->Release(mEdge);
+}
+//---
+cBdd cBdd::operator!() const {
+    return mpManager->Not(*this);
+}
+//---
+cBdd cBdd::operator&( const cBdd& aOther ) const {
+    return mpManager->And(*this, aOther);
+}
+//---
+cBdd cBdd::operator|( const cBdd& aOther ) const {
+    return mpManager->Or(*this, aOther);
+}
+//---
+cBdd cBdd::operator^( const cBdd& aOther ) const {
+    return mpManager->Xor(*this, aOther);
+}
+
+
+//---cBddManager Implementation------------------------------------------------
+const std::uint32_t cBddManager::TrueEdge;
+const std::uint32_t cBddManager::FalseEdge;
+const std::uint32_t cBddManager::NoEdge;
+const std::uint32_t cBddManager::TerminalVar;
+const std::uint32_t cBddManager::FreeVar;
+//---
+cBddManager::cBddManager( int aNumVars, size_t aCacheEntries )
+    : mNumVars(aNumVars),
+      mBucketMask(0),
+      mFreeList(NoEdge),
+      mNumFree(0),
+      mCacheMask(0),
+      mGcThreshold(InitialGcThreshold),
+      mPeakNodes(1),
+      mNumCollections(0),
+      mCacheLookups(0),
+      mCacheHits(0) {
+
+    mNodes.push_back(cNode{ TerminalVar, TrueEdge, TrueEdge, NoEdge, 1 }); // Never collected
+    Rehash(InitialBuckets);
+
+    size_t Size = 2;
+    while (Size < aCacheEntries)
+        Size *= 2;
+    mCache.assign(Size, cCacheEntry{ NoEdge, NoEdge, NoEdge, OP_AND });
+    mCacheMask = Size - 1;
+}
+//---
+int cBddManager::AddVar() {
+    return mNumVars++;
+}
+//---
+cBdd cBddManager::GetVar( int aVar ) {
+    MaybeCollect();
+    return cBdd(this, MakeNode(static_cast<std::uint32_t>(aVar), FalseEdge, TrueEdge));
+}
+//---
+cBdd cBddManager::And( const cBdd& aF, const cBdd& aG ) {
+    MaybeCollect(); // Only between operations: the recursion's partial results are not referenced
+    return cBdd(this, AndEdges(aF.mEdge, aG.mEdge));
+}
+//---
+cBdd cBddManager::Or( const cBdd& aF, const cBdd& aG ) {
+    MaybeCollect();
+    return cBdd(this, AndEdges(aF.mEdge ^ 1, aG.mEdge ^ 1) ^ 1); // De Morgan, free with complement edges
+}
+//---
+cBdd cBddManager::Xor( const cBdd& aF, const cBdd& aG ) {
+    MaybeCollect();
+    return cBdd(this, XorEdges(aF.mEdge, aG.mEdge));
+}
+//---
+size_t cBddManager::GetBucket( std::uint32_t aVar, std::uint32_t aLow, std::uint32_t aHigh ) const {
+    return Mix(aVar, aLow, aHigh) & mBucketMask;
+}
+//---
+size_t cBddManager::GetCacheSlot( eOp aOp, std::uint32_t aF, std::uint32_t aG ) const {
+    return Mix(aOp, aF, aG) & mCacheMask;
+}
+//---
+std::uint32_t cBddManager::MakeNode( std::uint32_t aVar, std::uint32_t aLow, std::uint32_t aHigh ) {
+    if (aLow == aHigh)
+        return aLow; // Redundant test
+    if (aHigh & 1)
+        return MakeNode(aVar, aLow ^ 1, aHigh ^ 1) ^ 1; // Keep the high edge plain; the complement moves to the caller's edge
+
+    const size_t Bucket = GetBucket(aVar, aLow, aHigh);
+    for (std::uint32_t n = mBuckets[Bucket]; n != NoEdge; n = mNodes[n].mNext) {
+        const cNode& Node = mNodes[n];
+        if (Node.mVar == aVar && Node.mLow == aLow && Node.mHigh == aHigh)
+            return n << 1;
+    }
+
+    std::uint32_t Index;
+    if (mFreeList != NoEdge) {
+        Index = mFreeList;
+        mFreeList = mNodes[Index].mNext;
+        --mNumFree;
+        mNodes[Index] = cNode{ aVar, aLow, aHigh, mBuckets[Bucket], 0 };
+    } else {
+        Index = static_cast<std::uint32_t>(mNodes.size());
+        mNodes.push_back(cNode{ aVar, aLow, aHigh, mBuckets[Bucket], 0 });
+    }
+    mBuckets[Bucket] = Index;
+
+    mPeakNodes = std::max(mPeakNodes, GetNumNodes());
+    if (GetNumNodes() > mBuckets.size())
+        Rehash(mBuckets.size() * 2);
+    return Index << 1;
+}
+//---
+void cBddManager::Rehash( size_t aNumBuckets ) {
+    mBuckets.assign(aNumBuckets, NoEdge);
+    mBucketMask = aNumBuckets - 1;
+    for (std::uint32_t n = 1; n < mNodes.size(); ++n) {
+        cNode& Node = mNodes[n];
+        if (Node.mVar == FreeVar)
+            continue;
+        const size_t Bucket = GetBucket(Node.mVar, Node.mLow, Node.mHigh);
+        Node.mNext = mBuckets[Bucket];
+        mBuckets[Bucket] = n;
+    }
+}
+//---
+void cBddManager::Cofactors( std::uint32_t aEdge, std::uint32_t aVar, std::uint32_t& aLow, std::uint32_t& aHigh ) const {
+    const cNode& Node = mNodes[aEdge >> 1];
+    if (Node.mVar != aVar) {
+        aLow = aHigh = aEdge; // Does not depend on aVar
+        return;
+    }
+    const std::uint32_t Complement = aEdge & 1;
+    aLow = Node.mLow ^ Complement;
+    aHigh = Node.mHigh ^ Complement;
+}
+//---
+std::uint32_t cBddManager::AndEdges( std::uint32_t aF, std::uint32_t aG ) {
+    if (aF == aG || aG == TrueEdge)
+        return aF;
+    if (aF == TrueEdge)
+        return aG;
+    if (aF == (aG ^ 1) || aF == FalseEdge || aG == FalseEdge)
+        return FalseEdge;
+    if (aF > aG)
+        std::swap(aF, aG); // Commutative: one cache entry for both orders
+
+    const size_t Slot = GetCacheSlot(OP_AND, aF, aG);
+    ++mCacheLookups;
+    if (mCache[Slot].mF == aF && mCache[Slot].mG == aG && mCache[Slot].mOp == OP_AND) {
+        ++mCacheHits;
+        return mCache[Slot].mResult;
+    }
+
+    const std::uint32_t Var = std::min(GetVarOf(aF), GetVarOf(aG));
+    std::uint32_t F0, F1, G0, G1;
+    Cofactors(aF, Var, F0, F1);
+    Cofactors(aG, Var, G0, G1);
+    const std::uint32_t Low = AndEdges(F0, G0);
+    const std::uint32_t High = AndEdges(F1, G1);
+    const std::uint32_t Result = MakeNode(Var, Low, High);
+
+    mCache[Slot] = cCacheEntry{ aF, aG, Result, OP_AND };
+    return Result;
+}
+//---
+std::uint32_t cBddManager::XorEdges( std::uint32_t aF, std::uint32_t aG ) {
+    if (aF == aG)
+        return FalseEdge;
+    if (aF == (aG ^ 1))
+        return TrueEdge;
+    if (aF == FalseEdge)
+        return aG;
+    if (aG == FalseEdge)
+        return aF;
+    if (aF == TrueEdge)
+        return aG ^ 1;
+    if (aG == TrueEdge)
+        return aF ^ 1;
+
+    // !f ^ g == !(f ^ g): compute on plain edges and complement the result
+    const std::uint32_t Complement = (aF ^ aG) & 1;
+    aF &= ~1u;
+    aG &= ~1u;
+    if (aF > aG)
+        std::swap(aF, aG);
+
+    const size_t Slot = GetCacheSlot(OP_XOR, aF, aG);
+    ++mCacheLookups;
+    if (mCache[Slot].mF == aF && mCache[Slot].mG == aG && mCache[Slot].mOp == OP_XOR) {
+        ++mCacheHits;
+        return mCache[Slot].mResult ^ Complement;
+    }
+
+    const std::uint32_t Var = std::min(GetVarOf(aF), GetVarOf(aG));
+    std::uint32_t F0, F1, G0, G1;
+    Cofactors(aF, Var, F0, F1);
+    Cofactors(aG, Var, G0, G1);
+    const std::uint32_t Low = XorEdges(F0, G0);
+    const std::uint32_t High = XorEdges(F1, G1);
+    const std::uint32_t Result = MakeNode(Var, Low, High);
+
+    mCache[Slot] = cCacheEntry{ aF, aG, Result, OP_XOR };
+    return Result ^ Complement;
+}
+//---
+void cBddManager::MaybeCollect() {
+    if (GetNumNodes() < mGcThreshold)
+        return;
+    CollectGarbage();
+    if (GetNumNodes() > mGcThreshold / 2)
+        mGcThreshold *= 2; // Mostly live: collecting again soon would free little
+}
+//---
+void cBddManager::CollectGarbage() {
+    // Mark everything reachable from a referenced node
+    std::vector<std::uint8_t> Marked(mNodes.size(), 0);
+    std::vector<std::uint32_t> Stack;
+    Marked[0] = 1;
+    for (std::uint32_t n = 1; n < mNodes.size(); ++n) {
+        if (mNodes[n].mRefs > 0 && mNodes[n].mVar != FreeVar) {
+            Marked[n] = 1;
+            Stack.push_back(n);
+        }
+    }
+    while (!Stack.empty()) {
+        const cNode& Node = mNodes[Stack.back()];
+        Stack.pop_back();
+        for (std::uint32_t Child : { Node.mLow >> 1, Node.mHigh >> 1 }) {
+            if (!Marked[Child]) {
+                Marked[Child] = 1;
+                Stack.push_back(Child);
+            }
+        }
+    }
+
+    // Sweep the rest onto the free list; results cached for them are no longer valid
+    for (std::uint32_t n = 1; n < mNodes.size(); ++n) {
+        if (!Marked[n] && mNodes[n].mVar != FreeVar) {
+            mNodes[n].mVar = FreeVar;
+            mNodes[n].mNext = mFreeList;
+            mFreeList = n;
+            ++mNumFree;
+        }
+    }
+    Rehash(mBuckets.size());
+    std::fill(mCache.begin(), mCache.end(), cCacheEntry{ NoEdge, NoEdge, NoEdge, OP_AND });
+    ++mNumCollections;
+}
+//---
+std::vector<cBdd> cBddManager::Evaluate( const cNetlist& aNetlist, const std::vector<cBdd>& aInputs ) {
+    const int NumGates = aNetlist.GetNumGates();
+
+    // Drop each net once its last reader is built, so collection can reclaim it
+    std::vector<int> LastUse(aNetlist.GetNumNets(), -1);
+    for (int g = 0; g < NumGates; ++g) {
+        for (int Net : { aNetlist.GetInputA(g), aNetlist.GetInputB(g) }) {
+            if (Net >= 0)
+                LastUse[Net] = g;
+        }
+    }
+    for (int o = 0; o < aNetlist.GetNumOutputs(); ++o)
+        LastUse[aNetlist.GetOutput(o)] = NumGates;
+
+    std::vector<cBdd> Nets(aNetlist.GetNumNets());
+    std::copy(aInputs.begin(), aInputs.begin() + aNetlist.GetNumInputs(), Nets.begin());
+    for (int g = 0; g < NumGates; ++g) {
+        const int A = aNetlist.GetInputA(g);
+        const int B = aNetlist.GetInputB(g);
+        cBdd& Out = Nets[aNetlist.GetOutputNet(g)];
+        switch (aNetlist.GetOpcode(g)) {
+            case cNetlist::OP_AND:    Out = And(Nets[A], Nets[B]); break;
+            case cNetlist::OP_OR:     Out = Or(Nets[A], Nets[B]); break;
+            case cNetlist::OP_XOR:    Out = Xor(Nets[A], Nets[B]); break;
+            case cNetlist::OP_NAND:   Out = Not(And(Nets[A], Nets[B])); break;
+            case cNetlist::OP_NOR:    Out = Not(Or(Nets[A], Nets[B])); break;
+            case cNetlist::OP_XNOR:   Out = Not(Xor(Nets[A], Nets[B])); break;
+            case cNetlist::OP_NOT:    Out = Not(Nets[A]); break;
+            case cNetlist::OP_BUF:    Out = Nets[A]; break;
+            case cNetlist::OP_CONST0: Out = GetFalse(); break;
+            case cNetlist::OP_CONST1: Out = GetTrue(); break;
+        }
+        for (int Net : { A, B }) {
+            if (Net >= 0 && LastUse[Net] == g)
+                Nets[Net] = cBdd();
+        }
+    }
+
+    std::vector<cBdd> Outputs;
+    Outputs.reserve(aNetlist.GetNumOutputs());
+    for (int o = 0; o < aNetlist.GetNumOutputs(); ++o)
+        Outputs.push_back(Nets[aNetlist.GetOutput(o)]);
+    return Outputs;
+}
+//---
+double cBddManager::CountSatisfying( const cBdd& aF ) {
+    // Fraction of assignments reaching TRUE from each node's plain edge; a complemented edge gives 1 - p
+    std::unordered_map<std::uint32_t, double> Fraction;
+    Fraction[0] = 1.0;
+    std::vector<std::uint32_t> Stack{ aF.mEdge >> 1 };
+    while (!Stack.empty()) {
+        const std::uint32_t n = Stack.back();
+        if (Fraction.count(n) != 0) {
+            Stack.pop_back();
+            continue;
+        }
+        const cNode& Node = mNodes[n];
+        const std::uint32_t Low = Node.mLow >> 1;
+        const std::uint32_t High = Node.mHigh >> 1;
+        if (Fraction.count(Low) == 0 || Fraction.count(High) == 0) {
+            Stack.push_back(Low);
+            Stack.push_back(High);
+            continue;
+        }
+        const double LowFraction = Node.mLow & 1 ? 1.0 - Fraction[Low] : Fraction[Low];
+        Fraction[n] = 0.5 * (LowFraction + Fraction[High]);
+        Stack.pop_back();
+    }
+    const double Root = aF.mEdge & 1 ? 1.0 - Fraction[aF.mEdge >> 1] : Fraction[aF.mEdge >> 1];
+    return std::ldexp(Root, mNumVars);
+}
+//---
+bool cBddManager::GetSatisfying( const cBdd& aF, std::vector<int>& aValues ) {
+    aValues.assign(mNumVars, -1);
+    if (aF.mEdge == FalseEdge)
+        return false;
+
+    // Every edge other than FALSE reaches TRUE, so any branch not equal to FALSE will do
+    std::uint32_t Edge = aF.mEdge;
+    while ((Edge >> 1) != 0) {
+        const cNode& Node = mNodes[Edge >> 1];
+        const std::uint32_t Low = Node.mLow ^ (Edge & 1);
+        if (Low != FalseEdge) {
+            aValues[Node.mVar] = 0;
+            Edge = Low;
+        } else {
+            aValues[Node.mVar] = 1;
+            Edge = Node.mHigh ^ (Edge & 1);
+        }
+    }
+    return true;
+}
+//---
+size_t cBddManager::GetNodeCount( const cBdd& aF ) {
+    std::vector<std::uint8_t> Seen(mNodes.size(), 0);
+    std::vector<std::uint32_t> Stack{ aF.mEdge >> 1 };
+    size_t Count = 0;
+    while (!Stack.empty()) {
+        const std::uint32_t n = Stack.back();
+        Stack.pop_back();
+        if (Seen[n])
+            continue;
+        Seen[n] = 1;
+        ++Count;
+        if (n != 0) {
+            Stack.push_back(mNodes[n].mLow >> 1);
+            Stack.push_back(mNodes[n].mHigh >> 1);
+        }
+    }
+    return Count;
+}
+
+
+//---cEquivalenceChecker Implementation----------------------------------------
+std::vector<int> cEquivalenceChecker::GetInterleavedOrder( int aNumInputs, int aNumBuses ) {
+    std::vector<int> Order(aNumInputs);
+    const int Width = aNumBuses > 0 ? aNumInputs / aNumBuses : 0;
+    for (int i = 0; i < aNumInputs; ++i) {
+        if (i < Width * aNumBuses)
+            Order[i] = (i % Width) * aNumBuses + i / Width;
+        else
+            Order[i] = i; // Inputs beyond the buses keep their place at the bottom
+    }
+    return Order;
+}
+//---
+bool cEquivalenceChecker::Check( const cNetlist& aFirst, const cNetlist& aSecond ) {
+    mError.clear();
+    mFailingOutput = -1;
+    mCounterexample.clear();
+    mPeakNodes = 0;
+
+    const int NumInputs = aFirst.GetNumInputs();
+    if (aSecond.GetNumInputs() != NumInputs || aSecond.GetNumOutputs() != aFirst.GetNumOutputs()) {
+        mError = "circuits differ in shape: " + std::to_string(NumInputs) + "/" + std::to_string(aFirst.GetNumOutputs())
+               + " against " + std::to_string(aSecond.GetNumInputs()) + "/" + std::to_string(aSecond.GetNumOutputs()) + " inputs/outputs";
+        return false;
+    }
+
+    std::vector<int> Order = mOrder;
+    if (Order.empty()) {
+        for (int i = 0; i < NumInputs; ++i)
+            Order.push_back(i);
+    }
+    std::vector<int> Sorted(Order);
+    std::sort(Sorted.begin(), Sorted.end());
+    for (int i = 0; i < NumInputs; ++i) {
+        if (static_cast<int>(Sorted.size()) != NumInputs || Sorted[i] != i) {
+            mError = "variable order is not a permutation of the " + std::to_string(NumInputs) + " inputs";
+            return false;
+        }
+    }
+
+    cBddManager Manager(NumInputs); // Declared first so every cBdd below is released before it
+    std::vector<cBdd> Inputs;
+    for (int i = 0; i < NumInputs; ++i)
+        Inputs.push_back(Manager.GetVar(Order[i]));
+    const std::vector<cBdd> First = Manager.Evaluate(aFirst, Inputs);
+    const std::vector<cBdd> Second = Manager.Evaluate(aSecond, Inputs);
+
+    for (int o = 0; o < aFirst.GetNumOutputs() && mFailingOutput < 0; ++o) {
+        if (First[o] == Second[o])
+            continue;
+        mFailingOutput = o;
+        std::vector<int> Values;
+        Manager.GetSatisfying(First[o] ^ Second[o], Values);
+        for (int i = 0; i < NumInputs; ++i)
+            mCounterexample.push_back(Values[Order[i]] == 1 ? cLogic::LOGIC_HIGH : cLogic::LOGIC_LOW);
+    }
+    mPeakNodes = Manager.GetPeakNodes();
+    return mFailingOutput < 0;
+}
@@ -0,0 +1,175 @@
+// File: bdd.hpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Header file for the reduced ordered BDD package, symbolic netlist evaluation
+//              and BDD-based combinational equivalence checking.
+
+#ifndef BDD_HPP
+#define BDD_HPP
+
+#include "netlist.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class cBddManager;
+
+// cBdd: A Boolean function owned by a cBddManager. Holding one keeps its nodes alive
+// across garbage collection; the manager must outlive every cBdd it returned.
+class cBdd {
+    public:
+        cBdd() : mpManager(nullptr), mEdge(0) {} // Unset; only assignment and destruction are valid
+        cBdd( const cBdd& aOther );
+        cBdd( cBdd&& aOther ) noexcept;
+        cBdd& operator=( const cBdd& aOther );
+        cBdd& operator=( cBdd&& aOther ) noexcept;
+        ~cBdd();
+
+        bool operator==( const cBdd& aOther ) const { return mEdge == aOther.mEdge && mpManager == aOther.mpManager; } // Canonical: equal functions, equal edges
+        bool operator!=( const cBdd& aOther ) const { return !(*this == aOther); }
+        bool IsTrue() const { return mEdge == 0; }
+        bool IsFalse() const { return mEdge == 1; }
+
+        cBdd operator!() const;
+        cBdd operator&( const cBdd& aOther ) const;
+        cBdd operator|( const cBdd& aOther ) const;
+        cBdd operator^( const cBdd& aOther ) const;
+
+        cBddManager* GetManager() const { return mpManager; }
+        std::uint32_t GetEdge() const { return mEdge; } // Node index * 2, plus 1 if complemented
+
+    private:
+        cBdd( cBddManager* apManager, std::uint32_t aEdge ); // Takes a reference on the node
+
+        cBddManager* mpManager;     // Manager owning the nodes
+        std::uint32_t mEdge;        // Edge to the root node
+
+        friend class cBddManager;
+};
+
+
+// cBddManager stores BDD nodes for a fixed variable order (variable 0 at the top).
+// Nodes are hash-consed through a unique table, so each function has exactly one
+// representation and equivalence is an edge comparison. Edges carry a complement bit,
+// making negation free and letting f and !f share every node; the high edge of a node is
+// never complemented, which keeps the form canonical. Operation results are memoised in a
+// lossy direct-mapped computed table. Nodes no cBdd can reach are reclaimed by a mark and
+// sweep collection, run between operations once the node count passes a threshold.
+class cBddManager {
+    public:
+        explicit cBddManager( int aNumVars = 0, size_t aCacheEntries = size_t(1) << 18 ); // Cache size is rounded up to a power of two
+        cBddManager( const cBddManager& ) = delete;            // cBdd handles point at the manager
+        cBddManager& operator=( const cBddManager& ) = delete;
+
+        int AddVar(); // Adds a variable below the existing ones and returns its index
+        int GetNumVars() const { return mNumVars; }
+
+        cBdd GetTrue() { return cBdd(this, TrueEdge); }
+        cBdd GetFalse() { return cBdd(this, FalseEdge); }
+        cBdd GetVar( int aVar ); // The function that is true when variable aVar is
+
+        cBdd Not( const cBdd& aF ) { return cBdd(this, aF.mEdge ^ 1); }
+        cBdd And( const cBdd& aF, const cBdd& aG );
+        cBdd Or( const cBdd& aF, const cBdd& aG );
+        cBdd Xor( const cBdd& aF, const cBdd& aG );
+
+        // Symbolic evaluation of a levelized netlist: aInputs holds one function per primary input
+        std::vector<cBdd> Evaluate( const cNetlist& aNetlist, const std::vector<cBdd>& aInputs );
+
+        double CountSatisfying( const cBdd& aF ); // Assignments of all GetNumVars variables making aF true
+        bool GetSatisfying( const cBdd& aF, std::vector<int>& aValues ); // One assignment making aF true (-1: either value); false if aF is FALSE
+        size_t GetNodeCount( const cBdd& aF ); // Nodes reachable from aF, terminal included
+
+        void CollectGarbage(); // Frees every node no cBdd can reach and clears the computed table
+        size_t GetNumNodes() const { return mNodes.size() - mNumFree; } // Allocated nodes, terminal included
+        size_t GetPeakNodes() const { return mPeakNodes; }
+        long long GetNumCollections() const { return mNumCollections; }
+        long long GetCacheLookups() const { return mCacheLookups; }
+        long long GetCacheHits() const { return mCacheHits; }
+
+    private:
+        // cNode: Decision on mVar; mHigh is never complemented
+        class cNode {
+            public:
+                std::uint32_t mVar;     // Variable tested (TerminalVar for the terminal, FreeVar when on the free list)
+                std::uint32_t mLow;     // Edge taken when the variable is 0
+                std::uint32_t mHigh;    // Edge taken when the variable is 1
+                std::uint32_t mNext;    // Next node in the same unique table bucket, or in the free list
+                std::uint32_t mRefs;    // cBdd handles on this node
+        };
+
+        // cCacheEntry: One memoised operation result
+        class cCacheEntry {
+            public:
+                std::uint32_t mF;       // First operand, NoEdge when empty
+                std::uint32_t mG;       // Second operand
+                std::uint32_t mResult;
+                std::uint32_t mOp;      // eOp
+        };
+
+        enum eOp : std::uint32_t { OP_AND, OP_XOR };
+
+        static const std::uint32_t TrueEdge = 0;
+        static const std::uint32_t FalseEdge = 1;
+        static const std::uint32_t NoEdge = 0xFFFFFFFFu;
+        static const std::uint32_t TerminalVar = 0x7FFFFFFFu; // Below every variable
+        static const std::uint32_t FreeVar = 0xFFFFFFFFu;
+
+        std::uint32_t GetVarOf( std::uint32_t aEdge ) const { return mNodes[aEdge >> 1].mVar; }
+        std::uint32_t MakeNode( std::uint32_t aVar, std::uint32_t aLow, std::uint32_t aHigh ); // Reduced, canonical node for the decision
+        void Cofactors( std::uint32_t aEdge, std::uint32_t aVar, std::uint32_t& aLow, std::uint32_t& aHigh ) const;
+        std::uint32_t AndEdges( std::uint32_t aF, std::uint32_t aG ); // Recursive AND
+        std::uint32_t XorEdges( std::uint32_t aF, std::uint32_t aG ); // Recursive XOR
+        size_t GetCacheSlot( eOp aOp, std::uint32_t aF, std::uint32_t aG ) const;
+        size_t GetBucket( std::uint32_t aVar, std::uint32_t aLow, std::uint32_t aHigh ) const;
+        void Rehash( size_t aNumBuckets ); // Rebuilds the unique table from the allocated nodes
+        void MaybeCollect(); // Collects garbage if the node count passed the threshold
+        void AddRef( std::uint32_t aEdge ) { ++mNodes[aEdge >> 1].mRefs; }
+        void Release( std::uint32_t aEdge ) { --mNodes[aEdge >> 1].mRefs; }
+
+        int mNumVars;                           // Variables created
+        std::vector<cNode> mNodes;              // Node 0 is the terminal (TRUE on a plain edge)
+        std::vector<std::uint32_t> mBuckets;    // Unique table: first node of each hash chain
+        size_t mBucketMask;
+        std::uint32_t mFreeList;                // First free node, NoEdge if none
+        size_t mNumFree;                        // Nodes on the free list
+        std::vector<cCacheEntry> mCache;        // Computed table
+        size_t mCacheMask;
+        size_t mGcThreshold;                    // Allocated nodes that trigger the next collection
+        size_t mPeakNodes;                      // See GetPeakNodes
+        long long mNumCollections;              // See GetNumCollections
+        long long mCacheLookups;                // See GetCacheLookups
+        long long mCacheHits;                   // See GetCacheHits
+
+        friend class cBdd;
+};
+
+
+// cEquivalenceChecker proves two compiled circuits with the same shape compute the same
+// outputs, by building both symbolically over shared variables and comparing the edges.
+// The input order matters as much as the circuits: an adder's BDDs stay linear in the width
+// when each A bit sits next to its B bit, and grow exponentially when all of A comes first.
+class cEquivalenceChecker {
+    public:
+        cEquivalenceChecker() : mFailingOutput(-1), mPeakNodes(0) {}
+
+        void SetOrder( const std::vector<int>& aVarOfInput ) { mOrder = aVarOfInput; } // BDD variable of each input (default: input i is variable i)
+        static std::vector<int> GetInterleavedOrder( int aNumInputs, int aNumBuses ); // Bit k of every bus adjacent, e.g. A0 B0 A1 B1 ... for an adder
+
+        bool Check( const cNetlist& aFirst, const cNetlist& aSecond ); // True if every output matches for every input; see GetError when false
+
+        const std::string& GetError() const { return mError; } // Why the check could not run (empty if it ran)
+        int GetFailingOutput() const { return mFailingOutput; } // First differing output, -1 if none
+        const std::vector<cLogic::eLogicLevel>& GetCounterexample() const { return mCounterexample; } // Inputs on which it differs
+        size_t GetPeakNodes() const { return mPeakNodes; } // BDD nodes the check needed at most
+
+    private:
+        std::vector<int> mOrder;                            // See SetOrder
+        std::string mError;                                 // See GetError
+        int mFailingOutput;                                 // See GetFailingOutput
+        std::vector<cLogic::eLogicLevel> mCounterexample;   // See GetCounterexample
+        size_t mPeakNodes;                                  // See GetPeakNodes
+};
+
+#endif // BDD_HPP
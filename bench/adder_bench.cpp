@@ -0,0 +1,98 @@
+// File: adder_bench.cpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Compares the N-bit adder architectures by gate count, logic depth and simulation throughput.
+
+#include "../adders.hpp"
+#include "../netlist.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+typedef std::chrono::steady_clock tClock;
+
+// Xorshift generator so every run applies the same vectors
+std::uint64_t NextRandom( std::uint64_t& aState ) {
+    aState ^= aState << 13;
+    aState ^= aState >> 7;
+    aState ^= aState << 17;
+    return aState;
+}
+
+double Seconds( tClock::time_point aStart ) {
+    return std::chrono::duration<double>(tClock::now() - aStart).count();
+}
+
+// Measures one adder: structure from its compiled netlist, then scalar, packed and compiled throughput
+template<class tAdder>
+void BenchAdder( int aBits ) {
+    tAdder Adder;
+    cNetlist Netlist;
+    if (!Netlist.Compile(Adder)) {
+        std::printf("%-16s %3d  failed to compile\n", tAdder::GetName(), aBits);
+        return;
+    }
+
+    const int NumInputs = Adder.GetNumInputs();
+    std::uint64_t Seed = 0x2545F4914F6CDD1Dull;
+
+    // Scalar: one vector per evaluation through the object model
+    std::vector<cLogic::eLogicLevel> Levels(NumInputs);
+    const int ScalarVectors = 20000;
+    tClock::time_point Start = tClock::now();
+    for (int v = 0; v < ScalarVectors; ++v) {
+        const std::uint64_t A = NextRandom(Seed), B = NextRandom(Seed);
+        for (int Bit = 0; Bit < aBits; ++Bit) {
+            Levels[tAdder::InputA(Bit)] = ((A >> Bit) & 1) ? cLogic::LOGIC_HIGH : cLogic::LOGIC_LOW;
+            Levels[tAdder::InputB(Bit)] = ((B >> Bit) & 1) ? cLogic::LOGIC_HIGH : cLogic::LOGIC_LOW;
+        }
+        Adder.DriveInputs(Levels.data(), NumInputs);
+    }
+    const double ScalarRate = ScalarVectors / Seconds(Start);
+
+    // Packed: 64 vectors per evaluation through the object model, then through the compiled netlist
+    std::vector<cLogic::tPackedLevel> In(NumInputs), Out(Adder.GetNumOutputs()), Nets;
+    for (cLogic::tPackedLevel& Word : In)
+        Word = NextRandom(Seed);
+
+    const int PackedPasses = 20000;
+    Start = tClock::now();
+    for (int p = 0; p < PackedPasses; ++p) {
+        In[p % NumInputs] ^= Out[0];
+        Adder.ComputePacked(In.data(), Out.data());
+    }
+    const double PackedRate = double(PackedPasses) * cLogic::PackedWidth / Seconds(Start);
+
+    Start = tClock::now();
+    for (int p = 0; p < PackedPasses; ++p) {
+        In[p % NumInputs] ^= Out[0];
+        Netlist.EvaluatePacked(In.data(), Out.data(), Nets);
+    }
+    const double CompiledRate = double(PackedPasses) * cLogic::PackedWidth / Seconds(Start);
+
+    std::printf("%-16s %3d %7d %6d %14.3e %14.3e %14.3e\n", tAdder::GetName(), aBits,
+                Netlist.GetNumGates(), Netlist.GetNumLevels(), ScalarRate, PackedRate, CompiledRate);
+}
+
+template<int N>
+void BenchWidth() {
+    BenchAdder<cRippleCarryAdder<N>>(N);
+    BenchAdder<cCarryLookaheadAdder<N>>(N);
+    BenchAdder<cBrentKungAdder<N>>(N);
+    BenchAdder<cKoggeStoneAdder<N>>(N);
+}
+
+} // namespace
+
+int main() {
+    std::printf("%-16s %3s %7s %6s %14s %14s %14s\n", "architecture", "N", "gates", "depth",
+                "scalar vec/s", "packed vec/s", "compiled vec/s");
+    BenchWidth<8>();
+    BenchWidth<16>();
+    BenchWidth<32>();
+    BenchWidth<64>();
+    return 0;
+}
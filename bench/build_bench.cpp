@@ -0,0 +1,90 @@
+// File: build_bench.cpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Measures the time and resident memory taken to build, settle and free a large cGateNetwork.
+//              Usage: build_bench [arena|heap] [gates]. Run each mode in its own process so the
+//              resident set of one does not hide the other.
+
+#include "../gate_network.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <unistd.h>
+
+namespace {
+
+typedef std::chrono::steady_clock tClock;
+
+double Seconds( tClock::time_point aStart ) {
+    return std::chrono::duration<double>(tClock::now() - aStart).count();
+}
+
+// Current resident set size in bytes (0 where /proc is unavailable)
+long ResidentBytes() {
+    long Pages = 0, Resident = 0;
+    FILE* pFile = std::fopen("/proc/self/statm", "r");
+    if (pFile == nullptr)
+        return 0;
+    if (std::fscanf(pFile, "%ld %ld", &Pages, &Resident) != 2)
+        Resident = 0;
+    std::fclose(pFile);
+    return Resident * sysconf(_SC_PAGESIZE);
+}
+
+// Adds one two-input gate, either from the network's arena or as a separate heap object
+template<class tGate>
+void AddTwoInput( cGateNetwork& aNetwork, bool aUseArena, int aA, int aB, int aOut ) {
+    if (aUseArena)
+        aNetwork.CreateGate<tGate>({ aA, aB }, { aOut });
+    else
+        aNetwork.AddGate(new tGate, { aA, aB }, { aOut });
+}
+
+} // namespace
+
+int main( int argc, char** argv ) {
+    const bool UseArena = argc < 2 || std::strcmp(argv[1], "heap") != 0;
+    const int NumGates = argc > 2 ? std::atoi(argv[2]) : 1000000;
+    const int NumInputs = 64;
+
+    const long StartBytes = ResidentBytes();
+    tClock::time_point Start = tClock::now();
+    double BuildTime = 0, SettleTime = 0;
+    long BuiltBytes = 0;
+    {
+        // A chain with a random second input per gate, so fanout is spread over the whole network
+        cGateNetwork Network(NumInputs, 1);
+        unsigned Seed = 1;
+        int Previous = 0;
+        for (int g = 0; g < NumGates; ++g) {
+            Seed = Seed * 1664525u + 1013904223u;
+            int Other = NumInputs + static_cast<int>(Seed % static_cast<unsigned>(Network.GetNumWires() - NumInputs + 1)) - 1;
+            if (Other < NumInputs)
+                Other = static_cast<int>(Seed % NumInputs);
+            const int Out = Network.AddWire();
+            switch (g & 3) {
+                case 0:  AddTwoInput<cAndGate>(Network, UseArena, Other, Previous, Out); break;
+                case 1:  AddTwoInput<cOrGate>(Network, UseArena, Other, Previous, Out); break;
+                case 2:  AddTwoInput<cXorGate>(Network, UseArena, Other, Previous, Out); break;
+                default: AddTwoInput<cNandGate>(Network, UseArena, Other, Previous, Out); break;
+            }
+            Previous = Out;
+        }
+        Network.SetOutputWire(0, Previous);
+        Network.Finalize();
+        BuildTime = Seconds(Start);
+        BuiltBytes = ResidentBytes() - StartBytes;
+
+        tClock::time_point SettleStart = tClock::now();
+        Network.DriveInputBus(0x5555555555555555ull);
+        SettleTime = Seconds(SettleStart);
+        Start = tClock::now();
+    }
+    const double FreeTime = Seconds(Start);
+
+    std::printf("%-5s gates=%d build=%.3fs settle=%.3fs free=%.3fs rss=%.1fMB (%.0f B/gate)\n",
+                UseArena ? "arena" : "heap", NumGates, BuildTime, SettleTime, FreeTime,
+                BuiltBytes / 1e6, static_cast<double>(BuiltBytes) / NumGates);
+    return 0;
+}
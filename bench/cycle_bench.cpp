@@ -0,0 +1,235 @@
+// File: cycle_bench.cpp
+// Author: Dylan George
+// Date Modified: 17th October 2026
+// Description: Clocks a 32-bit LFSR and a four-stage pipelined 32-bit adder through
+//              cCycleSimulator, checks both against software models across all 64 lanes, and
+//              reports cycles per second. Also checks cDFlipFlop's edge, enable and reset rules.
+
+#include "../circuits.hpp"
+#include "../cycle_sim.hpp"
+#include "../logic_gates.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+typedef std::chrono::steady_clock tClock;
+
+double Seconds( tClock::time_point aStart ) {
+    return std::chrono::duration<double>(tClock::now() - aStart).count();
+}
+
+std::uint64_t Next( std::uint64_t& aSeed ) {
+    aSeed ^= aSeed << 13; aSeed ^= aSeed >> 7; aSeed ^= aSeed << 17;
+    return aSeed;
+}
+
+cLogic::tPackedLevel All( bool aHigh ) {
+    return aHigh ? ~cLogic::tPackedLevel(0) : 0;
+}
+
+// Lane aLane of aWidth consecutive state or output words, as a number
+std::uint64_t Lane( const cCycleSimulator& aSim, bool aOutputs, int aFirst, int aWidth, int aLane ) {
+    std::uint64_t Value = 0;
+    for (int Bit = 0; Bit < aWidth; ++Bit) {
+        const cLogic::tPackedLevel Word = aOutputs ? aSim.GetOutput(aFirst + Bit) : aSim.GetState(aFirst + Bit);
+        Value |= ((Word >> aLane) & 1) << Bit;
+    }
+    return Value;
+}
+
+//---32-bit Fibonacci LFSR, x^32 + x^22 + x^2 + x + 1, with enable and reset to 1
+const int LfsrBits = 32;
+
+std::uint32_t LfsrStep( std::uint32_t aState ) {
+    const std::uint32_t Feedback = ((aState >> 31) ^ (aState >> 21) ^ (aState >> 1) ^ aState) & 1;
+    return (aState << 1) | Feedback;
+}
+
+void RunLfsr( long long aCycles ) {
+    cSequentialCircuit Circuit;
+    const int Enable = Circuit.AddInput();
+    const int Reset = Circuit.AddInput();
+    for (int f = 0; f < LfsrBits; ++f)
+        Circuit.AddFlipFlop(f == 0);
+    int Feedback = Circuit.AddGate(cNetlist::OP_XOR, Circuit.GetQ(31), Circuit.GetQ(21));
+    Feedback = Circuit.AddGate(cNetlist::OP_XOR, Feedback, Circuit.GetQ(1));
+    Feedback = Circuit.AddGate(cNetlist::OP_XOR, Feedback, Circuit.GetQ(0));
+    for (int f = 0; f < LfsrBits; ++f) {
+        Circuit.SetD(f, f == 0 ? Feedback : Circuit.GetQ(f - 1));
+        Circuit.SetEnable(f, Enable);
+        Circuit.SetReset(f, Reset);
+        Circuit.AddOutput(Circuit.GetQ(f));
+    }
+    if (!Circuit.Compile()) {
+        std::printf("lfsr32: %s\n", Circuit.GetError().c_str());
+        return;
+    }
+
+    // A different seed in every lane
+    cCycleSimulator Sim(Circuit);
+    std::uint64_t Seed = 0x9E3779B97F4A7C15ull;
+    std::vector<std::uint32_t> Model(cLogic::PackedWidth);
+    for (int n = 0; n < cLogic::PackedWidth; ++n)
+        Model[n] = static_cast<std::uint32_t>(Next(Seed)) | 1;
+    for (int f = 0; f < LfsrBits; ++f) {
+        cLogic::tPackedLevel Word = 0;
+        for (int n = 0; n < cLogic::PackedWidth; ++n)
+            Word |= cLogic::tPackedLevel((Model[n] >> f) & 1) << n;
+        Sim.SetState(f, Word);
+    }
+    Sim.SetInput(0, All(true));
+    Sim.SetInput(1, All(false));
+
+    const tClock::time_point Start = tClock::now();
+    Sim.Run(aCycles);
+    const double Elapsed = Seconds(Start);
+
+    bool Match = true;
+    for (int n = 0; n < cLogic::PackedWidth; ++n) {
+        std::uint32_t State = Model[n];
+        for (long long c = 0; c < aCycles; ++c)
+            State = LfsrStep(State);
+        Model[n] = State;
+        Match = Match && Lane(Sim, false, 0, LfsrBits, n) == State;
+    }
+
+    // Enable LOW holds, reset loads 1 in every lane
+    Sim.SetInput(0, All(false));
+    Sim.Run(10);
+    for (int n = 0; n < cLogic::PackedWidth; ++n)
+        Match = Match && Lane(Sim, false, 0, LfsrBits, n) == Model[n];
+    Sim.SetInput(1, All(true));
+    Sim.Step();
+    for (int n = 0; n < cLogic::PackedWidth; ++n)
+        Match = Match && Lane(Sim, false, 0, LfsrBits, n) == 1;
+
+    std::printf("lfsr32      %3d gates %3d flip-flops  %9lld cycles  %7.2f M cycles/s  %8.1f M lane-cycles/s  %s\n",
+                Circuit.GetLogic().GetNumGates(), Circuit.GetNumFlipFlops(), aCycles, aCycles / Elapsed / 1e6,
+                aCycles * cLogic::PackedWidth / Elapsed / 1e6, Match ? "match" : "MISMATCH");
+}
+
+//---32-bit adder in four 8-bit ripple stages, with A and B carried down the pipeline
+const int AdderBits = 32;
+const int StageBits = 8;
+const int NumStages = AdderBits / StageBits;
+
+void RunPipelinedAdder( long long aCycles ) {
+    cSequentialCircuit Circuit;
+    std::vector<int> A(AdderBits), B(AdderBits), Sum(AdderBits + 1);
+    for (int& Net : A)
+        Net = Circuit.AddInput();
+    for (int& Net : B)
+        Net = Circuit.AddInput();
+
+    // Each stage adds its slice on the operands as they arrive, then registers everything
+    int Carry = Circuit.AddGate(cNetlist::OP_CONST0);
+    cFullAdder FullAdder;
+    for (int Stage = 0; Stage < NumStages; ++Stage) {
+        for (int Bit = Stage * StageBits; Bit < (Stage + 1) * StageBits; ++Bit) {
+            const int In[3] = { A[Bit], B[Bit], Carry };
+            int Out[2];
+            Circuit.AddCircuit(FullAdder, In, Out);
+            Sum[Bit] = Out[0];
+            Carry = Out[1];
+        }
+        if (Stage + 1 == NumStages)
+            Sum[AdderBits] = Carry;
+
+        const auto Register = [&Circuit]( int& aNet ) {
+            const int FlipFlop = Circuit.AddFlipFlop();
+            Circuit.SetD(FlipFlop, aNet);
+            aNet = Circuit.GetQ(FlipFlop);
+        };
+        for (int Bit = 0; Bit < (Stage + 1) * StageBits; ++Bit)
+            Register(Sum[Bit]);
+        for (int Bit = (Stage + 1) * StageBits; Bit < AdderBits; ++Bit) {
+            Register(A[Bit]);
+            Register(B[Bit]);
+        }
+        if (Stage + 1 == NumStages)
+            Register(Sum[AdderBits]);
+        else
+            Register(Carry);
+    }
+    for (int Net : Sum)
+        Circuit.AddOutput(Net);
+    if (!Circuit.Compile()) {
+        std::printf("pipe_add32: %s\n", Circuit.GetError().c_str());
+        return;
+    }
+
+    // New random operands every cycle; the sum appears NumStages cycles later
+    cCycleSimulator Sim(Circuit);
+    std::uint64_t Seed = 0x2545F4914F6CDD1Dull;
+    std::vector<std::vector<cLogic::tPackedLevel>> Frames(1024, std::vector<cLogic::tPackedLevel>(2 * AdderBits));
+    for (std::vector<cLogic::tPackedLevel>& Frame : Frames)
+        for (cLogic::tPackedLevel& Word : Frame)
+            Word = Next(Seed);
+
+    bool Match = true;
+    for (size_t c = 0; c < 4 * Frames.size(); ++c) {
+        Sim.SetInputs(Frames[c % Frames.size()].data());
+        Sim.Step();
+        if (c < NumStages)
+            continue;
+        const std::vector<cLogic::tPackedLevel>& Applied = Frames[(c - NumStages) % Frames.size()];
+        for (int n = 0; n < cLogic::PackedWidth; ++n) {
+            std::uint64_t X = 0, Y = 0;
+            for (int Bit = 0; Bit < AdderBits; ++Bit) {
+                X |= ((Applied[Bit] >> n) & 1) << Bit;
+                Y |= ((Applied[AdderBits + Bit] >> n) & 1) << Bit;
+            }
+            Match = Match && Lane(Sim, true, 0, AdderBits + 1, n) == X + Y;
+        }
+    }
+
+    const tClock::time_point Start = tClock::now();
+    for (long long c = 0; c < aCycles; ++c) {
+        Sim.SetInputs(Frames[c % Frames.size()].data());
+        Sim.Step();
+    }
+    const double Elapsed = Seconds(Start);
+
+    std::printf("pipe_add32  %3d gates %3d flip-flops  %9lld cycles  %7.2f M cycles/s  %8.1f M lane-cycles/s  %s\n",
+                Circuit.GetLogic().GetNumGates(), Circuit.GetNumFlipFlops(), aCycles, aCycles / Elapsed / 1e6,
+                aCycles * cLogic::PackedWidth / Elapsed / 1e6, Match ? "match" : "MISMATCH");
+}
+
+//---One cDFlipFlop driven through its pins
+void CheckFlipFlop() {
+    const cLogic::eLogicLevel L = cLogic::LOGIC_LOW, H = cLogic::LOGIC_HIGH, X = cLogic::LOGIC_UNDEFINED;
+    cDFlipFlop FlipFlop(H);
+    bool Match = FlipFlop.GetOutputState(0) == X;
+
+    // D, EN, RST, then a full clock pulse; expected Q after the rising edge
+    const cLogic::eLogicLevel Steps[][4] = {
+        { H, H, L, H },     // Load 1
+        { L, L, L, H },     // Hold
+        { L, H, L, L },     // Load 0
+        { L, H, H, H },     // Reset to the reset level
+        { L, X, L, X },     // Enable undefined, D differs from Q
+        { L, H, L, L },     // Load 0
+        { L, X, L, L },     // Enable undefined, D matches Q
+        { L, H, X, X },     // Reset undefined, would load 0 but reset is 1
+    };
+    for (const cLogic::eLogicLevel* pStep : Steps) {
+        FlipFlop.DriveInputs({ pStep[0], L, pStep[1], pStep[2] });
+        FlipFlop.DriveInput(cDFlipFlop::INPUT_CLK, H);
+        Match = Match && FlipFlop.GetOutputState(0) == pStep[3];
+        FlipFlop.DriveInput(cDFlipFlop::INPUT_D, pStep[3] == H ? L : H); // No edge, no change
+        Match = Match && FlipFlop.GetOutputState(0) == pStep[3];
+    }
+    std::printf("dff         edge, enable and reset rules  %s\n", Match ? "match" : "MISMATCH");
+}
+
+} // namespace
+
+int main() {
+    CheckFlipFlop();
+    RunLfsr(10000000);
+    RunPipelinedAdder(2000000);
+    return 0;
+}
@@ -0,0 +1,124 @@
+// File: fault_bench.cpp
+// Author: Dylan George
+// Date Modified: 17th October 2026
+// Description: Grades random vector sets against every stuck-at fault of the built-in adders
+//              with cFaultSimulator, and checks each fault's first detecting vector against a
+//              serial reference that rebuilds the netlist with the fault wired in.
+
+#include "../adders.hpp"
+#include "../circuits.hpp"
+#include "../fault_sim.hpp"
+#include "../netlist.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+typedef std::chrono::steady_clock tClock;
+
+double Seconds( tClock::time_point aStart ) {
+    return std::chrono::duration<double>(tClock::now() - aStart).count();
+}
+
+// aNetlist with one fault made structural: the stuck net or pin is driven by a constant gate
+cNetlist Inject( const cNetlist& aNetlist, const cFaultSimulator::cFault& aFault ) {
+    const cNetlist::eOpcode Stuck = aFault.mStuckAt1 ? cNetlist::OP_CONST1 : cNetlist::OP_CONST0;
+    cNetlist Mutant;
+    std::vector<int> NetMap(aNetlist.GetNumNets());
+    for (int i = 0; i < aNetlist.GetNumInputs(); ++i)
+        NetMap[i] = Mutant.AddInput();
+    if (aFault.mGate < 0 && aFault.mNet < aNetlist.GetNumInputs())
+        NetMap[aFault.mNet] = Mutant.AddGate(Stuck);
+
+    for (int g = 0; g < aNetlist.GetNumGates(); ++g) {
+        int A = aNetlist.GetInputA(g) >= 0 ? NetMap[aNetlist.GetInputA(g)] : -1;
+        int B = aNetlist.GetInputB(g) >= 0 ? NetMap[aNetlist.GetInputB(g)] : -1;
+        if (aFault.mGate == g)
+            (aFault.mPin == 0 ? A : B) = Mutant.AddGate(Stuck);
+        const int Out = aNetlist.GetOutputNet(g);
+        NetMap[Out] = Mutant.AddGate(aNetlist.GetOpcode(g), A, B);
+        if (aFault.mGate < 0 && aFault.mNet == Out)
+            NetMap[Out] = Mutant.AddGate(Stuck);
+    }
+    for (int o = 0; o < aNetlist.GetNumOutputs(); ++o)
+        Mutant.AddOutput(NetMap[aNetlist.GetOutput(o)]);
+    Mutant.Levelize();
+    return Mutant;
+}
+
+// One fault at a time over the packed blocks; returns the first detecting vector or -1
+long long SerialDetect( const cNetlist& aGood, const cNetlist& aMutant, const std::vector<std::vector<cLogic::tPackedLevel>>& aBlocks, int aLastCount ) {
+    std::vector<cLogic::tPackedLevel> Good(aGood.GetNumOutputs()), Bad(aGood.GetNumOutputs()), Nets;
+    for (size_t b = 0; b < aBlocks.size(); ++b) {
+        aGood.EvaluatePacked(aBlocks[b].data(), Good.data(), Nets);
+        aMutant.EvaluatePacked(aBlocks[b].data(), Bad.data(), Nets);
+        cLogic::tPackedLevel Diff = 0;
+        for (size_t o = 0; o < Good.size(); ++o)
+            Diff |= Good[o] ^ Bad[o];
+        if (b + 1 == aBlocks.size() && aLastCount < cLogic::PackedWidth)
+            Diff &= (cLogic::tPackedLevel(1) << aLastCount) - 1;
+        if (Diff != 0) {
+            int v = 0;
+            while (!((Diff >> v) & 1))
+                ++v;
+            return static_cast<long long>(b) * cLogic::PackedWidth + v;
+        }
+    }
+    return -1;
+}
+
+void Run( const char* apName, const cNetlist& aNetlist, int aNumVectors, bool aExhaustive ) {
+    // Vector v is the binary number v when exhaustive, else pseudo-random
+    const int NumInputs = aNetlist.GetNumInputs();
+    std::vector<std::vector<cLogic::tPackedLevel>> Blocks((aNumVectors + cLogic::PackedWidth - 1) / cLogic::PackedWidth,
+                                                          std::vector<cLogic::tPackedLevel>(NumInputs, 0));
+    std::uint64_t Seed = 0x9E3779B97F4A7C15ull;
+    for (int v = 0; v < aNumVectors; ++v) {
+        for (int i = 0; i < NumInputs; ++i) {
+            Seed ^= Seed << 13; Seed ^= Seed >> 7; Seed ^= Seed << 17;
+            const bool Bit = aExhaustive ? (v >> i) & 1 : Seed >> 63;
+            Blocks[v / cLogic::PackedWidth][i] |= cLogic::tPackedLevel(Bit) << (v % cLogic::PackedWidth);
+        }
+    }
+    const int LastCount = aNumVectors - (static_cast<int>(Blocks.size()) - 1) * cLogic::PackedWidth;
+
+    cFaultSimulator Faults(aNetlist);
+    tClock::time_point Start = tClock::now();
+    for (size_t b = 0; b < Blocks.size(); ++b)
+        Faults.Simulate(Blocks[b].data(), b + 1 == Blocks.size() ? LastCount : cLogic::PackedWidth);
+    const double ParallelSeconds = Seconds(Start);
+
+    Start = tClock::now();
+    int Mismatches = 0;
+    for (const cFaultSimulator::cFault& Fault : Faults.GetFaults()) {
+        if (SerialDetect(aNetlist, Inject(aNetlist, Fault), Blocks, LastCount) != Fault.mDetectedBy)
+            ++Mismatches;
+    }
+    const double SerialSeconds = Seconds(Start);
+
+    std::printf("%-10s %5d gates %6d faults %5d vectors  coverage %6.2f%%  parallel-fault %8.2f ms (%7lld words)  serial %9.2f ms  %s\n",
+                apName, aNetlist.GetNumGates(), Faults.GetNumFaults(), aNumVectors, 100.0 * Faults.GetCoverage(),
+                1e3 * ParallelSeconds, Faults.GetNumWords(), 1e3 * SerialSeconds,
+                Mismatches == 0 ? "match" : "MISMATCH");
+}
+
+template<class tCircuit>
+cNetlist CompileCircuit() {
+    cNetlist Netlist;
+    Netlist.Compile(tCircuit());
+    return Netlist;
+}
+
+} // namespace
+
+int main() {
+    Run("three_bit", CompileCircuit<cThreeBitAdder>(), 64, true);
+    Run("rca16", CompileCircuit<cRippleCarryAdder<16>>(), 256, false);
+    Run("rca64", CompileCircuit<cRippleCarryAdder<64>>(), 1024, false);
+    Run("cla64", CompileCircuit<cCarryLookaheadAdder<64>>(), 1024, false);
+    Run("ks64", CompileCircuit<cKoggeStoneAdder<64>>(), 1024, false);
+    Run("bk64", CompileCircuit<cBrentKungAdder<64>>(), 1024, false);
+    return 0;
+}
@@ -0,0 +1,86 @@
+// File: level_bench.cpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Compares cLevelParallelEngine with the single-threaded cNetlist::EvaluatePacked
+//              on large generated layered circuits.
+//              Usage: level_bench [max threads] (default: every hardware thread).
+
+#include "../level_engine.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace {
+
+typedef std::chrono::steady_clock tClock;
+
+std::uint64_t NextRandom( std::uint64_t& aState ) {
+    aState ^= aState << 13;
+    aState ^= aState >> 7;
+    aState ^= aState << 17;
+    return aState;
+}
+
+// aDepth layers of aWidth random two-input gates, each reading any earlier net
+void Generate( cNetlist& aNetlist, int aInputs, int aWidth, int aDepth ) {
+    std::uint64_t Seed = 0x9E3779B97F4A7C15ull;
+    std::vector<int> Previous, Current;
+    for (int i = 0; i < aInputs; ++i)
+        Previous.push_back(aNetlist.AddInput());
+
+    for (int Layer = 0; Layer < aDepth; ++Layer) {
+        Current.clear();
+        for (int g = 0; g < aWidth; ++g) {
+            const int A = Previous[NextRandom(Seed) % Previous.size()];
+            const int B = Previous[NextRandom(Seed) % Previous.size()];
+            Current.push_back(aNetlist.AddGate(static_cast<cNetlist::eOpcode>(NextRandom(Seed) % 6), A, B));
+        }
+        Previous.swap(Current);
+    }
+    for (int o = 0; o < 64 && o < static_cast<int>(Previous.size()); ++o)
+        aNetlist.AddOutput(Previous[o]);
+    aNetlist.Levelize();
+}
+
+template<class tEval>
+double NanosecondsPerGate( const cNetlist& aNetlist, tEval aEval ) {
+    const int Repeats = 20;
+    aEval(); // Warm-up
+    tClock::time_point Start = tClock::now();
+    for (int r = 0; r < Repeats; ++r)
+        aEval();
+    return std::chrono::duration<double, std::nano>(tClock::now() - Start).count() / Repeats / aNetlist.GetNumGates();
+}
+
+} // namespace
+
+int main( int argc, char** argv ) {
+    const int MaxThreads = argc > 1 && std::atoi(argv[1]) > 0 ? std::atoi(argv[1]) : cThreadPool::GetHardwareThreads();
+    std::printf("%-8s %-6s %-8s %7s %12s %8s\n", "width", "depth", "threads", "levels", "ns/gate", "speedup");
+
+    const int Shapes[][2] = { { 1000, 200 }, { 20000, 50 }, { 200000, 20 } };
+    for (const auto& Shape : Shapes) {
+        cNetlist Netlist;
+        Generate(Netlist, 256, Shape[0], Shape[1]);
+
+        std::vector<cLogic::tPackedLevel> In(Netlist.GetNumInputs()), Expected(Netlist.GetNumOutputs()), Out(Netlist.GetNumOutputs()), Nets;
+        std::uint64_t Seed = 12345;
+        for (cLogic::tPackedLevel& Word : In)
+            Word = NextRandom(Seed);
+
+        const double Serial = NanosecondsPerGate(Netlist, [&] { Netlist.EvaluatePacked(In.data(), Expected.data(), Nets); });
+        std::printf("%-8d %-6d %-8s %7s %12.3f %8s\n", Shape[0], Shape[1], "serial", "-", Serial, "1.00x");
+
+        for (int Threads = 1; ; Threads = std::min(Threads * 2, MaxThreads)) {
+            cLevelParallelEngine Engine(Netlist, Threads);
+            const double Parallel = NanosecondsPerGate(Netlist, [&] { Engine.EvaluatePacked(In.data(), Out.data()); });
+            std::printf("%-8d %-6d %-8d %7d %12.3f %7.2fx%s\n", Shape[0], Shape[1], Threads, Engine.GetNumParallelLevels(),
+                        Parallel, Serial / Parallel, Out == Expected ? "" : "  MISMATCH");
+            if (Threads >= MaxThreads)
+                break;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,136 @@
+// File: native_bench.cpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Compares the interpreted packed netlist evaluator with natively compiled kernels
+//              (cNativeKernel) on the 64-bit adders, checks they agree, and times a cold compile
+//              against a load from the kernel cache.
+
+#include "../adders.hpp"
+#include "../native_kernel.hpp"
+#include "../netlist.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+typedef std::chrono::steady_clock tClock;
+
+const int NumBlocks = 4096;  // 64-vector blocks per timed pass
+const int NumPasses = 20;    // Timed passes over the blocks
+
+double Seconds( tClock::time_point aStart ) {
+    return std::chrono::duration<double>(tClock::now() - aStart).count();
+}
+
+template<class tAdder>
+void Run( const char* apName, const std::string& aCacheDir ) {
+    cNetlist Netlist;
+    Netlist.Compile(tAdder());
+    const int NumInputs = Netlist.GetNumInputs();
+    const int NumOutputs = Netlist.GetNumOutputs();
+
+    // Cold: nothing cached yet. Warm: a second kernel object finds the first one's build
+    cNativeKernel Kernel;
+    Kernel.SetCacheDir(aCacheDir);
+    tClock::time_point Start = tClock::now();
+    if (!Kernel.Build(Netlist)) {
+        std::printf("%-6s kernel build failed: %s\n", apName, Kernel.GetError().c_str());
+        return;
+    }
+    const double ColdMs = 1e3 * Seconds(Start);
+
+    cNativeKernel Cached;
+    Cached.SetCacheDir(aCacheDir);
+    Start = tClock::now();
+    const bool Loaded = Cached.Build(Netlist);
+    const double WarmMs = 1e3 * Seconds(Start);
+
+    std::vector<cLogic::tPackedLevel> In(static_cast<std::size_t>(NumBlocks) * NumInputs);
+    std::vector<cLogic::tPackedLevel> Expected(static_cast<std::size_t>(NumBlocks) * NumOutputs);
+    std::vector<cLogic::tPackedLevel> Actual(Expected.size()), Nets;
+    std::uint64_t Seed = 0x9E3779B97F4A7C15ull;
+    for (cLogic::tPackedLevel& Word : In) {
+        Seed ^= Seed << 13; Seed ^= Seed >> 7; Seed ^= Seed << 17;
+        Word = Seed;
+    }
+
+    Start = tClock::now();
+    for (int p = 0; p < NumPasses; ++p) {
+        for (int b = 0; b < NumBlocks; ++b)
+            Netlist.EvaluatePacked(&In[static_cast<std::size_t>(b) * NumInputs], &Expected[static_cast<std::size_t>(b) * NumOutputs], Nets);
+    }
+    const double Interpreted = Seconds(Start);
+
+    Start = tClock::now();
+    for (int p = 0; p < NumPasses; ++p) {
+        for (int b = 0; b < NumBlocks; ++b)
+            Kernel.Evaluate(&In[static_cast<std::size_t>(b) * NumInputs], &Actual[static_cast<std::size_t>(b) * NumOutputs]);
+    }
+    const double Native = Seconds(Start);
+    bool Match = Actual == Expected;
+
+    std::fill(Actual.begin(), Actual.end(), 0);
+    Start = tClock::now();
+    for (int p = 0; p < NumPasses; ++p)
+        Kernel.EvaluateBlocks(In.data(), Actual.data(), NumBlocks);
+    const double Blocks = Seconds(Start);
+    Match = Match && Actual == Expected;
+
+    const double Vectors = 64.0 * NumBlocks * NumPasses;
+    std::printf("%-6s %5d gates  interpreted %7.1f  native %7.1f  blocks %7.1f Mvec/s  (%4.1fx)  %s  compile %6.0f ms, cached load %5.2f ms%s\n",
+                apName, Netlist.GetNumGates(), Vectors / Interpreted / 1e6, Vectors / Native / 1e6, Vectors / Blocks / 1e6,
+                Interpreted / Blocks, Match ? "match" : "MISMATCH", ColdMs, WarmMs,
+                Loaded && Cached.WasCached() ? "" : " (cache miss)");
+}
+
+// cNativeCircuit as an ordinary gate: scalar evaluation against the interpreted compiled circuit
+bool CheckScalar( const std::string& aCacheDir ) {
+    setenv("LOGICSIM_KERNEL_CACHE", aCacheDir.c_str(), 1);
+    cRippleCarryAdder<8> Adder;
+    cNativeCircuit Native(Adder);
+    cCompiledCircuit Reference(Adder);
+    if (!Native.IsValid()) {
+        std::printf("scalar: %s\n", Native.GetError().c_str());
+        return false;
+    }
+
+    for (int Vector = 0; Vector < 1 << 16; Vector += 97) {
+        for (int i = 0; i < 16; ++i) {
+            const cLogic::eLogicLevel Level = (Vector >> i) & 1 ? cLogic::LOGIC_HIGH : cLogic::LOGIC_LOW;
+            Native.DriveInput(i, Level);
+            Reference.DriveInput(i, Level);
+        }
+        for (int o = 0; o < Native.GetNumOutputs(); ++o) {
+            if (Native.GetOutputState(o) != Reference.GetOutputState(o))
+                return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main() {
+    char Dir[] = "/tmp/native_bench.XXXXXX";
+    if (mkdtemp(Dir) == nullptr) {
+        std::perror("mkdtemp");
+        return 1;
+    }
+    const std::string CacheDir = Dir;
+
+    Run<cRippleCarryAdder<64>>("rca64", CacheDir);
+    Run<cCarryLookaheadAdder<64>>("cla64", CacheDir);
+    Run<cKoggeStoneAdder<64>>("ks64", CacheDir);
+    Run<cBrentKungAdder<64>>("bk64", CacheDir);
+
+    const bool ScalarOk = CheckScalar(CacheDir);
+    std::printf("scalar cNativeCircuit vs cCompiledCircuit: %s\n", ScalarOk ? "match" : "MISMATCH");
+
+    const std::string Remove = "rm -rf " + CacheDir;
+    return std::system(Remove.c_str()) == 0 && ScalarOk ? 0 : 1;
+}
@@ -0,0 +1,91 @@
+// File: parallel_bench.cpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Exhaustively checks a 12-bit ripple-carry adder with cParallelSimulator and reports
+//              throughput and speedup for a growing number of threads.
+//              Usage: parallel_bench [max threads] (default: every hardware thread).
+
+#include "../adders.hpp"
+#include "../parallel_sim.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace {
+
+typedef std::chrono::steady_clock tClock;
+typedef cRippleCarryAdder<12> tAdder;
+
+double Seconds( tClock::time_point aStart ) {
+    return std::chrono::duration<double>(tClock::now() - aStart).count();
+}
+
+// Checks every lane of every block against A + B
+long long CountErrors( const std::vector<cLogic::tPackedLevel>& aOutputs, int aNumOutputs ) {
+    long long Errors = 0;
+    for (size_t b = 0; b < aOutputs.size() / aNumOutputs; ++b) {
+        for (int Lane = 0; Lane < cLogic::PackedWidth; ++Lane) {
+            const std::uint64_t Vector = b * cLogic::PackedWidth + Lane;
+            const std::uint64_t A = Vector & 0xFFF, B = (Vector >> 12) & 0xFFF;
+            std::uint64_t Sum = 0;
+            for (int o = 0; o < aNumOutputs; ++o)
+                Sum |= ((aOutputs[b * aNumOutputs + o] >> Lane) & 1) << o;
+            Errors += (Sum != A + B);
+        }
+    }
+    return Errors;
+}
+
+// Runs aRun for 1, 2, 4, ... threads and prints vectors/s, speedup and steals
+template<class tRun>
+void Sweep( const char* apName, int aNumOutputs, int aMaxThreads, tRun aRun ) {
+    std::vector<cLogic::tPackedLevel> Reference;
+    double SerialSeconds = 0;
+    for (int Threads = 1; ; Threads *= 2) {
+        if (Threads > aMaxThreads)
+            Threads = aMaxThreads;
+        cParallelSimulator Simulator(Threads);
+        std::vector<cLogic::tPackedLevel> Outputs;
+        aRun(Simulator, Outputs); // Warm-up: builds the per-worker circuits and touches the output pages
+        tClock::time_point Start = tClock::now();
+        aRun(Simulator, Outputs);
+        const double Elapsed = Seconds(Start);
+
+        long long Steals = 0;
+        for (const cParallelSimulator::cWorkerStats& Stats : Simulator.GetStats())
+            Steals += Stats.mSteals;
+        if (Threads == 1) {
+            SerialSeconds = Elapsed;
+            Reference = Outputs;
+        }
+
+        const double Vectors = double(Outputs.size() / aNumOutputs) * cLogic::PackedWidth;
+        std::printf("%-10s threads=%-3d %8.1f Mvec/s  speedup %5.2fx  steals=%-4lld %s\n", apName, Threads,
+                    Vectors / Elapsed / 1e6, SerialSeconds / Elapsed, Steals,
+                    Outputs == Reference && CountErrors(Outputs, aNumOutputs) == 0 ? "ok" : "MISMATCH");
+        if (Threads >= aMaxThreads)
+            break;
+    }
+}
+
+} // namespace
+
+int main( int argc, char** argv ) {
+    const int MaxThreads = argc > 1 && std::atoi(argv[1]) > 0 ? std::atoi(argv[1]) : cThreadPool::GetHardwareThreads();
+    std::printf("Exhaustive %s-%d adder, 2^24 vectors, %d hardware threads\n", tAdder::GetName(), 12, cThreadPool::GetHardwareThreads());
+
+    const cParallelSimulator::tCircuitFactory Factory = [] { return std::unique_ptr<cLogicGate>(new tAdder); };
+    Sweep("objects", 13, MaxThreads, [&]( cParallelSimulator& aSimulator, std::vector<cLogic::tPackedLevel>& aOutputs ) {
+        aSimulator.RunExhaustive(Factory, aOutputs);
+    });
+
+    tAdder Adder;
+    cNetlist Netlist;
+    Netlist.Compile(Adder);
+    Sweep("compiled", 13, MaxThreads, [&]( cParallelSimulator& aSimulator, std::vector<cLogic::tPackedLevel>& aOutputs ) {
+        aSimulator.RunExhaustive(Netlist, aOutputs);
+    });
+    return 0;
+}
@@ -0,0 +1,202 @@
+// File: scale_bench.cpp
+// Author: Dylan George
+// Date Modified: 17th October 2026
+// Description: Scaling driver for the synthetic circuits of circuit_gen.hpp. Grows each design
+//              and reports build time, memory per gate, event-driven and compiled evaluation
+//              throughput, and a functional check. Usage: scale_bench [max_gates] [array|wallace|tree|dag]
+//              Each size runs in its own forked process so resident memory starts clean.
+
+#include "../circuit_gen.hpp"
+#include "../netlist.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+typedef std::chrono::steady_clock tClock;
+
+const double MinSeconds = 0.2; // Each throughput loop runs at least this long
+
+double Seconds( tClock::time_point aStart ) {
+    return std::chrono::duration<double>(tClock::now() - aStart).count();
+}
+
+// Current resident set size in bytes (0 where /proc is unavailable)
+long ResidentBytes() {
+    long Pages = 0, Resident = 0;
+    FILE* pFile = std::fopen("/proc/self/statm", "r");
+    if (pFile == nullptr)
+        return 0;
+    if (std::fscanf(pFile, "%ld %ld", &Pages, &Resident) != 2)
+        Resident = 0;
+    std::fclose(pFile);
+    return Resident * sysconf(_SC_PAGESIZE);
+}
+
+std::uint64_t Next( std::uint64_t& aSeed ) {
+    aSeed ^= aSeed << 13; aSeed ^= aSeed >> 7; aSeed ^= aSeed << 17;
+    return aSeed;
+}
+
+// cPoint: One design at one size, with an arithmetic model when the result fits 64 bits
+class cPoint {
+    public:
+        std::string mName;
+        std::string mSize;
+        std::function<std::unique_ptr<cGateNetwork>()> mBuild;
+        int mNumOperands;   // Operands of mModel, each mOperandBits wide (0: no model)
+        int mOperandBits;
+        std::function<std::uint64_t( const std::vector<std::uint64_t>& )> mModel;
+};
+
+// Random lanes through the compiled netlist against the design's arithmetic
+const char* Check( const cPoint& aPoint, const cNetlist& aNetlist ) {
+    if (aPoint.mNumOperands == 0 || aPoint.mOperandBits > 32 || aNetlist.GetNumOutputs() > 64)
+        return "-";
+    std::vector<cLogic::tPackedLevel> In(aNetlist.GetNumInputs()), Out(aNetlist.GetNumOutputs()), Nets;
+    std::uint64_t Seed = 0x2545F4914F6CDD1Dull;
+    for (cLogic::tPackedLevel& Word : In)
+        Word = Next(Seed);
+    aNetlist.EvaluatePacked(In.data(), Out.data(), Nets);
+
+    std::vector<std::uint64_t> Operands(aPoint.mNumOperands);
+    for (int n = 0; n < cLogic::PackedWidth; ++n) {
+        for (int k = 0; k < aPoint.mNumOperands; ++k) {
+            Operands[k] = 0;
+            for (int Bit = 0; Bit < aPoint.mOperandBits; ++Bit)
+                Operands[k] |= ((In[k * aPoint.mOperandBits + Bit] >> n) & 1) << Bit;
+        }
+        std::uint64_t Result = 0;
+        for (size_t o = 0; o < Out.size(); ++o)
+            Result |= ((Out[o] >> n) & 1) << o;
+        if (Result != aPoint.mModel(Operands))
+            return "MISMATCH";
+    }
+    return "match";
+}
+
+void Measure( const cPoint& aPoint ) {
+    const long StartBytes = ResidentBytes();
+    tClock::time_point Start = tClock::now();
+    std::unique_ptr<cGateNetwork> pNetwork = aPoint.mBuild();
+    const double BuildSeconds = Seconds(Start);
+    const long NetworkBytes = ResidentBytes() - StartBytes;
+    const int NumGates = pNetwork->GetNumGates();
+
+    // Event-driven: random vectors after the first full settle
+    std::vector<cLogic::eLogicLevel> Levels(pNetwork->GetNumInputs());
+    std::uint64_t Seed = 0x9E3779B97F4A7C15ull;
+    long long Vectors = -1;
+    Start = tClock::now();
+    do {
+        if (Vectors == 0)
+            Start = tClock::now();
+        for (cLogic::eLogicLevel& Level : Levels)
+            Level = Next(Seed) >> 63 ? cLogic::LOGIC_HIGH : cLogic::LOGIC_LOW;
+        pNetwork->DriveInputs(Levels.data(), static_cast<int>(Levels.size()));
+        ++Vectors;
+    } while (Vectors < 1 || (Seconds(Start) < MinSeconds && Vectors < 10000));
+    const double EventUs = 1e6 * Seconds(Start) / Vectors;
+
+    // Compiled and levelized, 64 vectors per evaluation
+    const long BeforeCompile = ResidentBytes();
+    cNetlist Netlist;
+    Start = tClock::now();
+    const bool Compiled = Netlist.Compile(*pNetwork);
+    const double CompileSeconds = Seconds(Start);
+    const long NetlistBytes = ResidentBytes() - BeforeCompile;
+    if (!Compiled) {
+        std::printf("%-8s %-10s did not compile\n", aPoint.mName.c_str(), aPoint.mSize.c_str());
+        return;
+    }
+
+    std::vector<cLogic::tPackedLevel> In(Netlist.GetNumInputs()), Out(Netlist.GetNumOutputs()), Nets;
+    for (cLogic::tPackedLevel& Word : In)
+        Word = Next(Seed);
+    long long Evaluations = 0;
+    Start = tClock::now();
+    do {
+        Netlist.EvaluatePacked(In.data(), Out.data(), Nets);
+        In[Evaluations % In.size()] ^= Out[0];
+        ++Evaluations;
+    } while (Seconds(Start) < MinSeconds);
+    const double PackedSeconds = Seconds(Start);
+
+    std::printf("%-8s %-10s %9d %6d %8.3f %7.0f %10.1f %8.3f %7.0f %9.1f %10.2f  %s\n",
+                aPoint.mName.c_str(), aPoint.mSize.c_str(), NumGates, Netlist.GetNumLevels(),
+                BuildSeconds, static_cast<double>(NetworkBytes) / NumGates, EventUs,
+                CompileSeconds, static_cast<double>(NetlistBytes) / NumGates,
+                static_cast<double>(NumGates) * Evaluations / PackedSeconds / 1e6,
+                cLogic::PackedWidth * static_cast<double>(NumGates) * Evaluations / PackedSeconds / 1e9,
+                Check(aPoint, Netlist));
+}
+
+// Runs aPoint in a child process; false if it failed to run
+bool MeasureForked( const cPoint& aPoint ) {
+    std::fflush(stdout);
+    const pid_t Child = fork();
+    if (Child == 0) {
+        Measure(aPoint);
+        std::fflush(stdout);
+        _exit(0);
+    }
+    int Status = 0;
+    if (Child < 0 || waitpid(Child, &Status, 0) < 0 || !WIFEXITED(Status) || WEXITSTATUS(Status) != 0) {
+        std::printf("%-8s %-10s failed (out of memory?)\n", aPoint.mName.c_str(), aPoint.mSize.c_str());
+        return false;
+    }
+    return true;
+}
+
+std::uint64_t Product( const std::vector<std::uint64_t>& aOperands ) {
+    return aOperands[0] * aOperands[1];
+}
+
+std::uint64_t Total( const std::vector<std::uint64_t>& aOperands ) {
+    std::uint64_t Sum = 0;
+    for (std::uint64_t Operand : aOperands)
+        Sum += Operand;
+    return Sum;
+}
+
+} // namespace
+
+int main( int argc, char** argv ) {
+    const long long MaxGates = argc > 1 ? std::atoll(argv[1]) : 1000000;
+    const char* pOnly = argc > 2 ? argv[2] : nullptr;
+    const auto Wanted = [pOnly]( const char* apName ) { return pOnly == nullptr || std::strcmp(pOnly, apName) == 0; };
+
+    // Sizes grow until the estimated gate count passes MaxGates
+    std::vector<cPoint> Points;
+    for (int Bits = 8; Wanted("array") && 6LL * Bits * Bits <= MaxGates; Bits *= 2)
+        Points.push_back(cPoint{ "array", std::to_string(Bits) + "x" + std::to_string(Bits),
+                                 [Bits]() { return cCircuitGenerator::ArrayMultiplier(Bits); }, 2, Bits, Product });
+    for (int Bits = 8; Wanted("wallace") && 6LL * Bits * Bits <= MaxGates; Bits *= 2)
+        Points.push_back(cPoint{ "wallace", std::to_string(Bits) + "x" + std::to_string(Bits),
+                                 [Bits]() { return cCircuitGenerator::WallaceMultiplier(Bits); }, 2, Bits, Product });
+    for (int Operands = 16; Wanted("tree") && 5LL * 32 * Operands <= MaxGates; Operands *= 4)
+        Points.push_back(cPoint{ "tree", std::to_string(Operands) + "x32",
+                                 [Operands]() { return cCircuitGenerator::AdderTree(Operands, 32); }, Operands, 32, Total });
+    for (long long Gates = 10000; Wanted("dag") && Gates <= MaxGates; Gates *= 10) {
+        cCircuitGenerator::cRandomDagOptions Options;
+        Options.mNumGates = static_cast<int>(Gates);
+        Options.mDepth = 100;
+        Points.push_back(cPoint{ "dag", std::to_string(Gates / 1000) + "k/d100",
+                                 [Options]() { return cCircuitGenerator::RandomDag(Options); }, 0, 0, nullptr });
+    }
+
+    std::printf("%-8s %-10s %9s %6s %8s %7s %10s %8s %7s %9s %10s  %s\n",
+                "design", "size", "gates", "levels", "build s", "B/gate", "event us", "compile", "B/gate",
+                "M gate/s", "G lane/s", "check");
+    for (const cPoint& Point : Points)
+        MeasureForked(Point);
+    return 0;
+}
@@ -0,0 +1,148 @@
+// File: static_bench.cpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Compares the compile-time cells of static_circuits.hpp with the runtime library
+//              cells: packed evaluation, scalar evaluation through the cLogicGate interface, and
+//              the netlists both flatten to.
+
+#include "../adders.hpp"
+#include "../circuits.hpp"
+#include "../netlist.hpp"
+#include "../static_circuits.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+typedef std::chrono::steady_clock tClock;
+
+const int NumPacked = 2000000;  // Packed evaluations per timed loop
+const int NumScalar = 200000;   // Scalar evaluations per timed loop
+
+double NsPer( tClock::time_point aStart, int aCount ) {
+    return std::chrono::duration<double, std::nano>(tClock::now() - aStart).count() / aCount;
+}
+
+std::uint64_t Next( std::uint64_t& aSeed ) {
+    aSeed ^= aSeed << 13; aSeed ^= aSeed >> 7; aSeed ^= aSeed << 17;
+    return aSeed;
+}
+
+// Runtime cell's ComputePacked against the static cell's inlined Evaluate; each call's inputs
+// depend on the previous outputs so neither loop can be hoisted
+template<class tRuntime, class tCell>
+void ComparePacked( const char* apName ) {
+    tRuntime Runtime;
+    cLogic::tPackedLevel In[tCell::NumInputs], Out[tCell::NumOutputs], Expected[tCell::NumOutputs];
+    std::uint64_t Seed = 0x9E3779B97F4A7C15ull;
+    for (cLogic::tPackedLevel& Word : In)
+        Word = Next(Seed);
+
+    bool Match = true;
+    tClock::time_point Start = tClock::now();
+    for (int n = 0; n < NumPacked; ++n) {
+        Runtime.ComputePacked(In, Expected);
+        In[n % tCell::NumInputs] ^= Expected[tCell::NumOutputs - 1];
+    }
+    const double RuntimeNs = NsPer(Start, NumPacked);
+
+    Start = tClock::now();
+    for (int n = 0; n < NumPacked; ++n) {
+        tCell::Evaluate(In, Out);
+        In[n % tCell::NumInputs] ^= Out[tCell::NumOutputs - 1];
+    }
+    const double StaticNs = NsPer(Start, NumPacked);
+
+    for (int n = 0; n < 64; ++n) {
+        for (cLogic::tPackedLevel& Word : In)
+            Word = Next(Seed);
+        Runtime.ComputePacked(In, Expected);
+        tCell::Evaluate(In, Out);
+        for (int o = 0; o < tCell::NumOutputs; ++o)
+            Match = Match && Out[o] == Expected[o];
+    }
+
+    std::printf("packed %-11s runtime %7.2f ns  static %7.2f ns  (%5.1fx)  %s\n",
+                apName, RuntimeNs, StaticNs, RuntimeNs / StaticNs, Match ? "match" : "MISMATCH");
+}
+
+// Scalar evaluation through DriveInputs/GetOutputState, over every row of a small cell
+template<class tRuntime, class tCell>
+void CompareScalar( const char* apName ) {
+    tRuntime Runtime;
+    cStaticGate<tCell> Static;
+    const int NumRows = 1 << tCell::NumInputs;
+    std::vector<cLogic::eLogicLevel> Levels(tCell::NumInputs);
+
+    double Ns[2];
+    int High[2] = { 0, 0 }; // Outputs seen HIGH by each pass, which also keeps them live
+    for (int Pass = 0; Pass < 2; ++Pass) {
+        cLogicGate& Gate = Pass == 0 ? static_cast<cLogicGate&>(Runtime) : Static;
+        const tClock::time_point Start = tClock::now();
+        for (int n = 0; n < NumScalar; ++n) {
+            const int Row = n % NumRows;
+            for (int i = 0; i < tCell::NumInputs; ++i)
+                Levels[i] = (Row >> i) & 1 ? cLogic::LOGIC_HIGH : cLogic::LOGIC_LOW;
+            Gate.DriveInputs(Levels.data(), tCell::NumInputs);
+            High[Pass] += Gate.GetOutputState(tCell::NumOutputs - 1) == cLogic::LOGIC_HIGH;
+        }
+        Ns[Pass] = NsPer(Start, NumScalar);
+    }
+
+    bool Match = High[0] == High[1];
+    for (int Row = 0; Row < NumRows; ++Row) {
+        for (int i = 0; i < tCell::NumInputs; ++i)
+            Levels[i] = (Row >> i) & 1 ? cLogic::LOGIC_HIGH : cLogic::LOGIC_LOW;
+        Levels[Row % tCell::NumInputs] = Row & 1 ? Levels[Row % tCell::NumInputs] : cLogic::LOGIC_UNDEFINED; // Half the rows float one input
+        Runtime.DriveInputs(Levels.data(), tCell::NumInputs);
+        Static.DriveInputs(Levels.data(), tCell::NumInputs);
+        for (int o = 0; o < tCell::NumOutputs; ++o)
+            Match = Match && Runtime.GetOutputState(o) == Static.GetOutputState(o);
+    }
+
+    std::printf("scalar %-11s runtime %7.2f ns  static %7.2f ns  (%5.1fx)  %s\n",
+                apName, Ns[0], Ns[1], Ns[0] / Ns[1], Match ? "match" : "MISMATCH");
+}
+
+template<class tRuntime, class tCell>
+void CompareFlatten( const char* apName ) {
+    cNetlist Runtime, Static;
+    Runtime.Compile(tRuntime());
+    Static.Compile(cStaticGate<tCell>());
+
+    std::vector<cLogic::tPackedLevel> In(Runtime.GetNumInputs()), A(Runtime.GetNumOutputs()), B(Runtime.GetNumOutputs()), Nets;
+    std::uint64_t Seed = 0x2545F4914F6CDD1Dull;
+    bool Match = Runtime.GetNumGates() == Static.GetNumGates();
+    for (int n = 0; n < 256 && Match; ++n) {
+        for (cLogic::tPackedLevel& Word : In)
+            Word = Next(Seed);
+        Runtime.EvaluatePacked(In.data(), A.data(), Nets);
+        Static.EvaluatePacked(In.data(), B.data(), Nets);
+        Match = A == B;
+    }
+    std::printf("flatten %-10s runtime %5d gates  static %5d gates  %s\n",
+                apName, Runtime.GetNumGates(), Static.GetNumGates(), Match ? "match" : "MISMATCH");
+}
+
+} // namespace
+
+int main() {
+    ComparePacked<cHalfAdder, cStaticHalfAdderCell>("half_adder");
+    ComparePacked<cFullAdder, cStaticFullAdderCell>("full_adder");
+    ComparePacked<cThreeBitAdder, cStaticRippleAdderCell<3>>("three_bit");
+    ComparePacked<cRippleCarryAdder<64>, cStaticRippleAdderCell<64>>("rca64");
+
+    CompareScalar<cHalfAdder, cStaticHalfAdderCell>("half_adder");
+    CompareScalar<cFullAdder, cStaticFullAdderCell>("full_adder");
+    CompareScalar<cThreeBitAdder, cStaticRippleAdderCell<3>>("three_bit");
+
+    CompareFlatten<cThreeBitAdder, cStaticRippleAdderCell<3>>("three_bit");
+    CompareFlatten<cRippleCarryAdder<64>, cStaticRippleAdderCell<64>>("rca64");
+
+    std::printf("compile-time tables: full adder %zu bytes, three-bit adder %zu bytes, six-bit adder %zu bytes\n",
+                sizeof(cStaticTruthTable<cStaticFullAdderCell>::Table), sizeof(cStaticTruthTable<cStaticRippleAdderCell<3>>::Table),
+                sizeof(cStaticTruthTable<cStaticRippleAdderCell<6>>::Table));
+    return 0;
+}
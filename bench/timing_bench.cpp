@@ -0,0 +1,96 @@
+// File: timing_bench.cpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Measures cTimingSimulator throughput (events/s) and reports settle times, hazards and
+//              critical paths for random vectors through ripple-carry and prefix adders. The final
+//              run slows every OR gate of a ripple-carry adder through cLogicGate::SetDelay.
+
+#include "../adders.hpp"
+#include "../netlist.hpp"
+#include "../timing_sim.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace {
+
+typedef std::chrono::steady_clock tClock;
+
+const int NumVectors = 200000;
+const int NumChecked = 2000; // Vectors compared against the zero-delay evaluator
+
+// Sets the delay of every OR gate below aGate
+void SlowOrGates( cLogicGate& aGate, int aDelay ) {
+    aGate.ForEachChild([aDelay]( cLogicGate& aChild, const std::string& ) {
+        if (dynamic_cast<cOrGate*>(&aChild) != nullptr)
+            aChild.SetDelay(aDelay);
+        SlowOrGates(aChild, aDelay);
+    });
+}
+
+void Run( const char* apName, const cLogicGate& aCircuit ) {
+    cNetlist Netlist;
+    if (!Netlist.Compile(aCircuit)) {
+        std::printf("%-12s cannot compile\n", apName);
+        return;
+    }
+    cTimingSimulator Sim(Netlist);
+
+    const int NumInputs = Netlist.GetNumInputs();
+    std::vector<cLogic::eLogicLevel> In(NumInputs), Expected(Netlist.GetNumOutputs()), Nets;
+    std::uint64_t Seed = 0x9E3779B97F4A7C15ull;
+    int Mismatches = 0;
+    long long SumSettle = 0;
+
+    const tClock::time_point Start = tClock::now();
+    for (int v = 0; v < NumVectors; ++v) {
+        for (int i = 0; i < NumInputs; ++i) {
+            if ((i & 63) == 0) {
+                Seed ^= Seed << 13; Seed ^= Seed >> 7; Seed ^= Seed << 17;
+            }
+            In[i] = (Seed >> (i & 63)) & 1 ? cLogic::LOGIC_HIGH : cLogic::LOGIC_LOW;
+        }
+        SumSettle += Sim.ApplyVector(In.data()).mSettleTime;
+
+        if (v < NumChecked) {
+            Netlist.Evaluate(In.data(), Expected.data(), Nets);
+            for (int o = 0; o < Netlist.GetNumOutputs(); ++o)
+                Mismatches += Sim.GetOutput(o) != Expected[o];
+        }
+    }
+    const double Seconds = std::chrono::duration<double>(tClock::now() - Start).count();
+
+    std::printf("%-12s gates=%-5d %6.2fM events/s %6.2fM evals/s  settle mean=%5.1f max=%-4lld glitches/vec=%5.2f filtered/vec=%5.2f mismatches=%d\n",
+                apName, Netlist.GetNumGates(), Sim.GetNumEvents() / Seconds / 1e6, Sim.GetNumEvaluations() / Seconds / 1e6,
+                double(SumSettle) / NumVectors, Sim.GetMaxSettleTime(), double(Sim.GetNumGlitches()) / NumVectors,
+                double(Sim.GetNumFilteredPulses()) / NumVectors, Mismatches);
+
+    // Worst case for a ripple: A all ones, then B's lowest bit rises and the carry runs the full width
+    const int Width = NumInputs / 2;
+    std::vector<cLogic::eLogicLevel> Ripple(NumInputs, cLogic::LOGIC_LOW);
+    for (int b = 0; b < Width; ++b)
+        Ripple[b] = cLogic::LOGIC_HIGH;
+    Sim.Initialize(Ripple.data());
+    Ripple[Width] = cLogic::LOGIC_HIGH;
+    const cTimingSimulator::cVectorStats& Worst = Sim.ApplyVector(Ripple.data());
+    std::printf("%-12s carry ripple: settle=%lld at output %d, critical path %d gates, %d output glitches\n",
+                "", Worst.mSettleTime, Worst.mCriticalOutput, static_cast<int>(Sim.GetCriticalPath().size()), Worst.mGlitches);
+}
+
+} // namespace
+
+int main() {
+    Run("rca16", cRippleCarryAdder<16>());
+    Run("rca64", cRippleCarryAdder<64>());
+    Run("cla64", cCarryLookaheadAdder<64>());
+    Run("ks64", cKoggeStoneAdder<64>());
+    Run("bk64", cBrentKungAdder<64>());
+
+    cRippleCarryAdder<16> Slow;
+    SlowOrGates(Slow, 8);
+    Run("rca16 slowOR", Slow);
+    return 0;
+}
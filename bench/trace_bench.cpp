@@ -0,0 +1,78 @@
+// File: trace_bench.cpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Measures the cost of VCD tracing on a scalar cRippleCarryAdder<16> simulation:
+//              untraced, fully traced, filtered to one subcircuit, and limited to a short window.
+//              Usage: trace_bench [vcd path] (default /tmp/trace_bench.vcd, overwritten per run).
+
+#include "../adders.hpp"
+#include "../wave_trace.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <sys/stat.h>
+
+namespace {
+
+typedef std::chrono::steady_clock tClock;
+
+const int NumVectors = 200000;
+
+// Simulates NumVectors random additions, one time step each, and returns ns per vector
+double Simulate( cRippleCarryAdder<16>& aAdder, cWaveTracer* apTracer ) {
+    std::uint64_t Seed = 0x9E3779B97F4A7C15ull;
+    tClock::time_point Start = tClock::now();
+    for (int v = 0; v < NumVectors; ++v) {
+        Seed ^= Seed << 13; Seed ^= Seed >> 7; Seed ^= Seed << 17;
+        if (apTracer != nullptr)
+            apTracer->SetTime(v);
+        aAdder.DriveInputBus(Seed & 0xFFFFFFFFull);
+    }
+    return std::chrono::duration<double, std::nano>(tClock::now() - Start).count() / NumVectors;
+}
+
+long FileBytes( const char* apPath ) {
+    struct stat Info;
+    return stat(apPath, &Info) == 0 ? static_cast<long>(Info.st_size) : 0;
+}
+
+// One traced run; an empty filter traces everything
+void RunTraced( const char* apLabel, const char* apPath, const char* apFilter, long long aWindowEnd, double aBaseline ) {
+    cRippleCarryAdder<16> Adder;
+    cWaveTracer Tracer;
+    if (*apFilter != '\0')
+        Tracer.AddFilter(apFilter);
+    Tracer.SetWindow(0, aWindowEnd);
+    Tracer.Attach(Adder, "adder");
+    if (!Tracer.Open(apPath)) {
+        std::printf("cannot create %s\n", apPath);
+        return;
+    }
+
+    const int NumSignals = Tracer.GetNumSignals();
+    const tClock::time_point Start = tClock::now();
+    const double Ns = Simulate(Adder, &Tracer);
+    Tracer.Close();
+    const double Total = std::chrono::duration<double, std::nano>(tClock::now() - Start).count() / NumVectors;
+
+    std::printf("%-10s %8.1f ns/vector (%5.2fx) %8.1f incl. drain  signals=%-4d changes=%-9lld stalls=%-6lld vcd=%.1fMB\n",
+                apLabel, Ns, Ns / aBaseline, Total, NumSignals, Tracer.GetNumChanges(), Tracer.GetNumStalls(),
+                FileBytes(apPath) / 1e6);
+}
+
+} // namespace
+
+int main( int argc, char** argv ) {
+    const char* pPath = argc > 1 ? argv[1] : "/tmp/trace_bench.vcd";
+
+    cRippleCarryAdder<16> Adder;
+    Simulate(Adder, nullptr); // Warm-up
+    const double Baseline = Simulate(Adder, nullptr);
+    std::printf("%-10s %8.1f ns/vector\n", "untraced", Baseline);
+
+    RunTraced("full", pPath, "", NumVectors, Baseline);
+    RunTraced("filtered", pPath, "adder.fa15.*", NumVectors, Baseline);
+    RunTraced("window", pPath, "", 1000, Baseline);
+    return 0;
+}
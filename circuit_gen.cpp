@@ -0,0 +1,280 @@
+// File: circuit_gen.cpp
+// Author: Dylan George
+// Date Modified: 17th October 2026
+// Description: Implementation file for cCircuitGenerator.
+
+//--Includes-------------------------------------------------------------------
+#include "circuit_gen.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+//---Local helpers-------------------------------------------------------------
+namespace {
+
+// cBuilder adds primitives to a network, one new wire per gate output
+class cBuilder {
+    public:
+        explicit cBuilder( cGateNetwork& aNetwork ) : mNetwork(aNetwork), mZero(-1) {}
+
+        template<class tGate>
+        int Gate( int aA, int aB ) {
+            const int Out = mNetwork.AddWire();
+            mNetwork.CreateGate<tGate>({ aA, aB }, { Out });
+            return Out;
+        }
+        template<class tGate>
+        int Gate( int aA ) {
+            const int Out = mNetwork.AddWire();
+            mNetwork.CreateGate<tGate>({ aA }, { Out });
+            return Out;
+        }
+        int Zero() { // One shared constant LOW
+            if (mZero < 0) {
+                mZero = mNetwork.AddWire();
+                mNetwork.CreateGate<cConstantGate>({}, { mZero }, cLogic::LOGIC_LOW);
+            }
+            return mZero;
+        }
+
+        // Adds up to three bits of one weight (-1 for absent): a wire, a half adder or a full
+        // adder. apCarry receives the carry, -1 if there cannot be one; nullptr skips building it.
+        int Add( int aA, int aB, int aC, int* apCarry ) {
+            if (aA < 0) std::swap(aA, aC);
+            if (aB < 0) std::swap(aB, aC);
+            if (aA < 0) std::swap(aA, aB);
+            if (apCarry != nullptr)
+                *apCarry = -1;
+            if (aA < 0)
+                return Zero();
+            if (aB < 0)
+                return aA;
+            const int Half = Gate<cXorGate>(aA, aB);
+            if (aC < 0) {
+                if (apCarry != nullptr)
+                    *apCarry = Gate<cAndGate>(aA, aB);
+                return Half;
+            }
+            if (apCarry != nullptr)
+                *apCarry = Gate<cOrGate>(Gate<cAndGate>(aA, aB), Gate<cAndGate>(Half, aC));
+            return Gate<cXorGate>(Half, aC);
+        }
+
+        // Ripple-carry sum of two little-endian operands, one bit wider than the wider of them
+        // unless aWidth caps it (the carry out of the top bit is then not built)
+        std::vector<int> Ripple( const std::vector<int>& aX, const std::vector<int>& aY, size_t aWidth ) {
+            const size_t Width = std::min(std::max(aX.size(), aY.size()) + 1, aWidth);
+            std::vector<int> Sum;
+            int Carry = -1;
+            for (size_t Bit = 0; Bit < Width; ++Bit) {
+                const int X = Bit < aX.size() ? aX[Bit] : -1;
+                const int Y = Bit < aY.size() ? aY[Bit] : -1;
+                if (X < 0 && Y < 0 && Carry < 0)
+                    break;
+                Sum.push_back(Add(X, Y, Carry, Bit + 1 < Width ? &Carry : nullptr));
+            }
+            return Sum;
+        }
+
+        // Drives outputs 0.. from aBits, zero-filling any missing top bits
+        void SetOutputs( const std::vector<int>& aBits ) {
+            for (int o = 0; o < mNetwork.GetNumOutputs(); ++o)
+                mNetwork.SetOutputWire(o, o < static_cast<int>(aBits.size()) ? aBits[o] : Zero());
+        }
+
+    private:
+        cGateNetwork& mNetwork;
+        int mZero;  // Constant LOW wire, -1 until needed
+};
+
+// Partial product columns of an aBits x aBits multiply: column w holds A[j] & B[i] for i + j = w
+std::vector<std::vector<int>> PartialProducts( cBuilder& aBuilder, int aBits ) {
+    std::vector<std::vector<int>> Columns(2 * static_cast<size_t>(aBits));
+    for (int i = 0; i < aBits; ++i)
+        for (int j = 0; j < aBits; ++j)
+            Columns[i + j].push_back(aBuilder.Gate<cAndGate>(j, aBits + i));
+    return Columns;
+}
+
+std::uint64_t NextRandom( std::uint64_t& aState ) {
+    aState ^= aState << 13; aState ^= aState >> 7; aState ^= aState << 17;
+    return aState;
+}
+
+} // namespace
+
+//---cCircuitGenerator Implementation------------------------------------------
+cCircuitGenerator::cRandomDagOptions::cRandomDagOptions()
+    : mNumInputs(64), mNumOutputs(64), mNumGates(10000), mDepth(32), mMaxFanout(8), mSeed(1) {
+
+    for (int k = 0; k < NUM_GATE_KINDS; ++k)
+        mMix[k] = k == GATE_NOT || k == GATE_BUF ? 0 : 1;
+}
+//---
+std::unique_ptr<cGateNetwork> cCircuitGenerator::ArrayMultiplier( int aBits ) {
+
+    aBits = std::max(aBits, 1);
+    std::unique_ptr<cGateNetwork> pNetwork(new cGateNetwork(2 * aBits, 2 * aBits));
+    cBuilder Builder(*pNetwork);
+
+    // Row i is A & B[i], shifted by i; each row is rippled into the running sum of the rows above
+    std::vector<int> Row(aBits);
+    std::vector<int> Product;
+    for (int i = 0; i < aBits; ++i) {
+        for (int j = 0; j < aBits; ++j)
+            Row[j] = Builder.Gate<cAndGate>(j, aBits + i);
+        if (i == 0) {
+            Product = Row;
+            continue;
+        }
+        const std::vector<int> Upper(Product.begin() + i, Product.end());
+        const std::vector<int> Sum = Builder.Ripple(Upper, Row, 2 * static_cast<size_t>(aBits) - i);
+        Product.resize(i);
+        Product.insert(Product.end(), Sum.begin(), Sum.end());
+    }
+    Builder.SetOutputs(Product);
+    pNetwork->Finalize();
+    return pNetwork;
+}
+//---
+std::unique_ptr<cGateNetwork> cCircuitGenerator::WallaceMultiplier( int aBits ) {
+
+    aBits = std::max(aBits, 1);
+    const size_t Width = 2 * static_cast<size_t>(aBits);
+    std::unique_ptr<cGateNetwork> pNetwork(new cGateNetwork(2 * aBits, 2 * aBits));
+    cBuilder Builder(*pNetwork);
+    std::vector<std::vector<int>> Columns = PartialProducts(Builder, aBits);
+
+    // Each layer takes every column's bits three at a time through full adders and a leftover
+    // pair through a half adder; sums stay in the column, carries move to the next one
+    bool Tall = true;
+    while (Tall) {
+        std::vector<std::vector<int>> Next(Width);
+        for (size_t w = 0; w < Width; ++w) {
+            const std::vector<int>& Column = Columns[w];
+            size_t b = 0;
+            for (; b + 1 < Column.size(); b += 3) {
+                int Carry = -1;
+                const int C = b + 2 < Column.size() ? Column[b + 2] : -1;
+                Next[w].push_back(Builder.Add(Column[b], Column[b + 1], C, w + 1 < Width ? &Carry : nullptr));
+                if (Carry >= 0)
+                    Next[w + 1].push_back(Carry);
+            }
+            if (b < Column.size())
+                Next[w].push_back(Column[b]);
+        }
+        Columns.swap(Next);
+        Tall = false;
+        for (const std::vector<int>& Column : Columns)
+            Tall = Tall || Column.size() > 2;
+    }
+
+    // Two rows left: one carry-propagate addition
+    std::vector<int> Product;
+    int Carry = -1;
+    for (size_t w = 0; w < Width; ++w) {
+        const int A = Columns[w].size() > 0 ? Columns[w][0] : -1;
+        const int B = Columns[w].size() > 1 ? Columns[w][1] : -1;
+        Product.push_back(Builder.Add(A, B, Carry, w + 1 < Width ? &Carry : nullptr));
+    }
+    Builder.SetOutputs(Product);
+    pNetwork->Finalize();
+    return pNetwork;
+}
+//---
+std::unique_ptr<cGateNetwork> cCircuitGenerator::AdderTree( int aOperands, int aBits ) {
+
+    aOperands = std::max(aOperands, 1);
+    aBits = std::max(aBits, 1);
+    int Levels = 0;
+    while ((1 << Levels) < aOperands)
+        ++Levels;
+    const int Width = aBits + Levels;
+    std::unique_ptr<cGateNetwork> pNetwork(new cGateNetwork(aOperands * aBits, Width));
+    cBuilder Builder(*pNetwork);
+
+    std::vector<std::vector<int>> Operands(aOperands);
+    for (int k = 0; k < aOperands; ++k)
+        for (int Bit = 0; Bit < aBits; ++Bit)
+            Operands[k].push_back(k * aBits + Bit);
+
+    // Pairwise sums level by level; an odd operand out waits for the next level
+    while (Operands.size() > 1) {
+        std::vector<std::vector<int>> Sums;
+        for (size_t k = 0; k + 1 < Operands.size(); k += 2)
+            Sums.push_back(Builder.Ripple(Operands[k], Operands[k + 1], Width));
+        if (Operands.size() % 2 != 0)
+            Sums.push_back(Operands.back());
+        Operands.swap(Sums);
+    }
+    Builder.SetOutputs(Operands[0]);
+    pNetwork->Finalize();
+    return pNetwork;
+}
+//---
+std::unique_ptr<cGateNetwork> cCircuitGenerator::RandomDag( const cRandomDagOptions& aOptions ) {
+
+    const int NumInputs = std::max(aOptions.mNumInputs, 1);
+    const int NumGates = std::max(aOptions.mNumGates, 1);
+    const int NumOutputs = std::min(std::max(aOptions.mNumOutputs, 1), NumGates);
+    const int Depth = std::min(std::max(aOptions.mDepth, 1), NumGates);
+    std::unique_ptr<cGateNetwork> pNetwork(new cGateNetwork(NumInputs, NumOutputs));
+    cBuilder Builder(*pNetwork);
+
+    int TotalWeight = 0;
+    for (int Weight : aOptions.mMix)
+        TotalWeight += std::max(Weight, 0);
+    std::uint64_t State = aOptions.mSeed * 0x9E3779B97F4A7C15ull + 1;
+
+    // Wires in build order: inputs, then each level's gates, so level l is a contiguous range
+    std::vector<int> Fanout(NumInputs, 0);
+    int LevelBegin = 0, LevelEnd = NumInputs;
+    int Cursor = 0; // Round-robin over the level below spreads the first operands evenly
+    for (int Level = 0; Level < Depth; ++Level) {
+        const int LevelGates = NumGates / Depth + (Level < NumGates % Depth ? 1 : 0);
+        for (int g = 0; g < LevelGates; ++g) {
+            const int A = LevelBegin + Cursor++ % (LevelEnd - LevelBegin);
+
+            // Second operand from anywhere below, the first draw under the fanout cap or else the least loaded draw
+            int B = -1;
+            for (int Draw = 0; Draw < 16; ++Draw) {
+                const int Candidate = static_cast<int>(NextRandom(State) % static_cast<std::uint64_t>(LevelEnd));
+                if (B < 0 || Fanout[Candidate] < Fanout[B])
+                    B = Candidate;
+                if (aOptions.mMaxFanout <= 0 || Fanout[B] < aOptions.mMaxFanout)
+                    break;
+            }
+
+            int Kind = GATE_AND;
+            if (TotalWeight > 0) {
+                int Pick = static_cast<int>(NextRandom(State) % static_cast<std::uint64_t>(TotalWeight));
+                for (Kind = 0; Pick >= std::max(aOptions.mMix[Kind], 0); ++Kind)
+                    Pick -= std::max(aOptions.mMix[Kind], 0);
+            }
+
+            int Out = -1;
+            switch (Kind) {
+                case GATE_AND:  Out = Builder.Gate<cAndGate>(A, B);  break;
+                case GATE_OR:   Out = Builder.Gate<cOrGate>(A, B);   break;
+                case GATE_XOR:  Out = Builder.Gate<cXorGate>(A, B);  break;
+                case GATE_NAND: Out = Builder.Gate<cNandGate>(A, B); break;
+                case GATE_NOR:  Out = Builder.Gate<cNorGate>(A, B);  break;
+                case GATE_XNOR: Out = Builder.Gate<cXnorGate>(A, B); break;
+                case GATE_NOT:  Out = Builder.Gate<cNotGate>(A);     break;
+                default:        Out = Builder.Gate<cBufGate>(A);     break;
+            }
+            ++Fanout[A];
+            if (Kind != GATE_NOT && Kind != GATE_BUF)
+                ++Fanout[B];
+            Fanout.resize(Out + 1, 0);
+        }
+        LevelBegin = LevelEnd;
+        LevelEnd += LevelGates;
+        Cursor = 0;
+    }
+
+    for (int o = 0; o < NumOutputs; ++o)
+        pNetwork->SetOutputWire(o, LevelEnd - NumOutputs + o);
+    pNetwork->Finalize();
+    return pNetwork;
+}
@@ -0,0 +1,55 @@
+// File: circuit_gen.hpp
+// Author: Dylan George
+// Date Modified: 17th October 2026
+// Description: Header file for cCircuitGenerator, which builds large parametric circuits
+//              (multipliers, adder trees, random DAGs) for stress and scaling measurements.
+
+#ifndef CIRCUIT_GEN_HPP
+#define CIRCUIT_GEN_HPP
+
+#include "gate_network.hpp"
+#include <memory>
+
+// cCircuitGenerator builds synthetic designs of any size from the library gate classes.
+// Every design is a cGateNetwork of cAndGate, cXorGate, ... created in the network's arena,
+// so it can be simulated event-driven as built or compiled into a cNetlist. Adder cells are
+// expanded into their primitives (two XORs, two ANDs and an OR for a full adder), so gate
+// counts and memory per gate compare directly across designs.
+//
+// Operands are little-endian: bit i of an operand is input wire First+i, and bit i of the
+// result is primary output i.
+class cCircuitGenerator {
+    public:
+        // eGateKind: Primitives a random DAG draws from, in cRandomDagOptions::mMix order
+        enum eGateKind { GATE_AND, GATE_OR, GATE_XOR, GATE_NAND, GATE_NOR, GATE_XNOR, GATE_NOT, GATE_BUF, NUM_GATE_KINDS };
+
+        // cRandomDagOptions: Shape of a random DAG
+        class cRandomDagOptions {
+            public:
+                cRandomDagOptions(); // 64 inputs, 64 outputs, 10000 gates, 32 levels, fanout 8, equal two-input mix
+
+                int mNumInputs;             // Primary inputs
+                int mNumOutputs;            // Primary outputs, taken from the last gates built
+                int mNumGates;              // Gates, spread evenly over the levels
+                int mDepth;                 // Logic levels; every gate reads one net of the level below it
+                int mMaxFanout;             // Loads per net the second operand avoids exceeding (0: unlimited)
+                int mMix[NUM_GATE_KINDS];   // Relative weight of each gate kind
+                unsigned long long mSeed;   // Same seed, same circuit
+        };
+
+        // Array multiplier: rows of AND partial products, each added in by a ripple-carry row.
+        // Inputs A (aBits) then B (aBits); 2 * aBits product outputs. About 6 * aBits^2 gates.
+        static std::unique_ptr<cGateNetwork> ArrayMultiplier( int aBits );
+
+        // Wallace-tree multiplier: the same partial products reduced column-wise by layers of
+        // full and half adders down to two rows, then one ripple-carry adder. Depth grows with log(aBits).
+        static std::unique_ptr<cGateNetwork> WallaceMultiplier( int aBits );
+
+        // Sum of aOperands aBits-bit numbers through a balanced tree of ripple-carry adders.
+        // Inputs operand 0 first; aBits + ceil(log2(aOperands)) outputs.
+        static std::unique_ptr<cGateNetwork> AdderTree( int aOperands, int aBits );
+
+        static std::unique_ptr<cGateNetwork> RandomDag( const cRandomDagOptions& aOptions );
+};
+
+#endif // CIRCUIT_GEN_HPP
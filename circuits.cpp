@@ -4,6 +4,9 @@
 // Description: Implementation file for circuit-related classes and functions.
 
 #include "circuits.hpp"
+#include "arena.hpp"
+#include "netlist.hpp"
+#include "static_circuits.hpp"
 
 // cSubCircuit constructor initializes the subcircuit with the given number of inputs and outputs.
 cSubCircuit::cSubCircuit(int aNumInputs, int aNumOutputs) 
@@ -22,32 +25,53 @@ void cHalfAdder::ComputeOutput() {
     // Compute the outputs for the half adder:
     // - AND gate computes carry output
     // - XOR gate computes sum output
-    mAND.DriveInput(INPUT_A, mInputs[INPUT_A]); // Set first input of AND gate
-    mAND.DriveInput(INPUT_B, mInputs[INPUT_B]); // Set second input of AND gate
-    mAND.ComputeOutput(); // Calculate AND gate output
+    // Each gate takes both inputs in one transaction, so it evaluates at most once
+    mAND.DriveInputs({ mInputs[INPUT_A], mInputs[INPUT_B] });
+    mXOR.DriveInputs({ mInputs[INPUT_A], mInputs[INPUT_B] });
 
-    mXOR.DriveInput(INPUT_A, mInputs[INPUT_A]); // Set first input of XOR gate
-    mXOR.DriveInput(INPUT_B, mInputs[INPUT_B]); // Set second input of XOR gate
-    mXOR.ComputeOutput(); // Calculate XOR gate output
+    SetOutput(SUM_OUTPUT, mXOR.GetOutputState(OUTPUT)); // Store XOR output as SUM
+    SetOutput(CARRY_OUTPUT, mAND.GetOutputState(OUTPUT)); // Store AND output as CARRY
+}
+//---
+void cHalfAdder::ComputePacked( const cLogic::tPackedLevel* apInputs, cLogic::tPackedLevel* apOutputs ) {
+    // Same wiring as ComputeOutput, but each signal carries 64 vectors
+    cLogic::tPackedLevel Carry, Sum;
+    mAND.ComputePacked(apInputs, &Carry);
+    mXOR.ComputePacked(apInputs, &Sum);
+
+    apOutputs[SUM_OUTPUT] = Sum;
+    apOutputs[CARRY_OUTPUT] = Carry;
+}
+//---
+bool cHalfAdder::Flatten( cNetlist& aNetlist, const int* apInputNets, int* apOutputNets ) const {
+    int Carry, Sum;
+    bool Ok = mAND.Flatten(aNetlist, apInputNets, &Carry)
+           && mXOR.Flatten(aNetlist, apInputNets, &Sum);
 
-    mOutputValues[SUM_OUTPUT] = mXOR.GetOutputState(OUTPUT); // Store XOR output as SUM
-    mOutputValues[CARRY_OUTPUT] = mAND.GetOutputState(OUTPUT); // Store AND output as CARRY
+    apOutputNets[SUM_OUTPUT] = Sum;
+    apOutputNets[CARRY_OUTPUT] = Carry;
+    return Ok;
+}
+//---
+void cHalfAdder::ForEachChild( const std::function<void( cLogicGate&, const std::string& )>& aVisit ) {
+    aVisit(mAND, "and");
+    aVisit(mXOR, "xor");
 }
 //---
 void cHalfAdder::TestOutputs() {
     // Print the truth table for the half adder
-    std::cout << "\nTest Output for Half Adder" << std::endl;
-    std::cout << "A B | Sum Cout" << std::endl;
-    std::cout << "----------------" << std::endl;
+    std::cout << "\nTest Output for Half Adder\n";
+    std::cout << "A B | Sum Cout\n";
+    std::cout << "----------------\n";
+
+    // Rows come from the compile-time table (static_circuits.hpp), where row bit i drives input i
+    typedef cStaticTruthTable<cStaticHalfAdderCell> tTable;
     for (int i = 0; i < 4; i++) {
         int A = (i >> 1) & 1;
         int B = i & 1;
-        DriveInput(INPUT_A, A ? cLogic::LOGIC_HIGH : cLogic::LOGIC_LOW);
-        DriveInput(INPUT_B, B ? cLogic::LOGIC_HIGH : cLogic::LOGIC_LOW);
-        ComputeOutput();
-        int Sum = GetOutputState(SUM_OUTPUT);
-        int Cout = GetOutputState(CARRY_OUTPUT);
-        std::cout << A << " " << B << " |  " << Sum << "    " << Cout << std::endl;
+        int Sum = tTable::Get(A << INPUT_A | B << INPUT_B, SUM_OUTPUT);
+        int Cout = tTable::Get(A << INPUT_A | B << INPUT_B, CARRY_OUTPUT);
+        std::cout << A << " " << B << " |  " << Sum << "    " << Cout << "\n";
     }
 }
 
@@ -64,51 +88,70 @@ void cFullAdder::ComputeOutput() {
     // - First half adder adds A and B
     // - Second half adder adds sum from first half adder and carry-in
     // - OR gate combines carry outputs
-    mHalfAdder1.DriveInput(INPUT_A, mInputs[INPUT_A]); 
-    mHalfAdder1.DriveInput(INPUT_B, mInputs[INPUT_B]);
-    mHalfAdder1.ComputeOutput(); 
+    mHalfAdder1.DriveInputs({ mInputs[INPUT_A], mInputs[INPUT_B] });
+    mHalfAdder2.DriveInputs({ mHalfAdder1.GetOutputState(SUM_OUTPUT), mInputs[INPUT_CARRY] });
+
+    SetOutput(SUM_OUTPUT, mHalfAdder2.GetOutputState(SUM_OUTPUT));
 
-    mHalfAdder2.DriveInput(INPUT_A, mHalfAdder1.GetOutputState(SUM_OUTPUT));
-    mHalfAdder2.DriveInput(INPUT_B, mInputs[INPUT_CARRY]);
-    mHalfAdder2.ComputeOutput();
+    mOR.DriveInputs({ mHalfAdder2.GetOutputState(CARRY_OUTPUT), mHalfAdder1.GetOutputState(CARRY_OUTPUT) });
 
-    mOutputValues[SUM_OUTPUT] = mHalfAdder2.GetOutputState(SUM_OUTPUT); 
+    SetOutput(CARRY_OUTPUT, mOR.GetOutputState(OUTPUT));
+}
+//---
+void cFullAdder::ComputePacked( const cLogic::tPackedLevel* apInputs, cLogic::tPackedLevel* apOutputs ) {
+    // Same wiring as ComputeOutput, but each signal carries 64 vectors
+    cLogic::tPackedLevel HA1[2], HA2[2];
+    mHalfAdder1.ComputePacked(apInputs, HA1);
 
-    mOR.DriveInput(INPUT_A, mHalfAdder2.GetOutputState(CARRY_OUTPUT));
-    mOR.DriveInput(INPUT_B, mHalfAdder1.GetOutputState(CARRY_OUTPUT) );
-    mOR.ComputeOutput();
+    cLogic::tPackedLevel HA2In[2] = { HA1[SUM_OUTPUT], apInputs[INPUT_CARRY] };
+    mHalfAdder2.ComputePacked(HA2In, HA2);
 
-    mOutputValues[CARRY_OUTPUT] = mOR.GetOutputState(OUTPUT);
+    cLogic::tPackedLevel ORIn[2] = { HA2[CARRY_OUTPUT], HA1[CARRY_OUTPUT] };
+    mOR.ComputePacked(ORIn, &apOutputs[CARRY_OUTPUT]);
+    apOutputs[SUM_OUTPUT] = HA2[SUM_OUTPUT];
+}
+//---
+bool cFullAdder::Flatten( cNetlist& aNetlist, const int* apInputNets, int* apOutputNets ) const {
+    int HA1[2], HA2[2];
+    if( !mHalfAdder1.Flatten(aNetlist, apInputNets, HA1) ) return false;
+
+    int HA2In[2] = { HA1[SUM_OUTPUT], apInputNets[INPUT_CARRY] };
+    if( !mHalfAdder2.Flatten(aNetlist, HA2In, HA2) ) return false;
+
+    int ORIn[2] = { HA2[CARRY_OUTPUT], HA1[CARRY_OUTPUT] };
+    if( !mOR.Flatten(aNetlist, ORIn, &apOutputNets[CARRY_OUTPUT]) ) return false;
+    apOutputNets[SUM_OUTPUT] = HA2[SUM_OUTPUT];
+    return true;
+}
+//---
+void cFullAdder::ForEachChild( const std::function<void( cLogicGate&, const std::string& )>& aVisit ) {
+    aVisit(mHalfAdder1, "ha1");
+    aVisit(mHalfAdder2, "ha2");
+    aVisit(mOR, "or");
 }
 //---
 void cFullAdder::TestOutputs() {
     // Print the truth table for the full adder
-    std::cout << "\nTest Output for Full Adder " << std::endl;
-    std::cout << "A B Cin | Sum Cout" << std::endl;
-    std::cout << "------------------" << std::endl;
+    std::cout << "\nTest Output for Full Adder \n";
+    std::cout << "A B Cin | Sum Cout\n";
+    std::cout << "------------------\n";
 
-    // Loop through all input combinations (0 to 7)
+    // Rows come from the compile-time table (static_circuits.hpp), where row bit i drives input i
+    typedef cStaticTruthTable<cStaticFullAdderCell> tTable;
     for (int i = 0; i < 8; i++) {
         // Extract bits for A, B, Cin
-        int A   = (i >> 2) & 1;  // MSB
-        int B   = (i >> 1) & 1;  // Middle bit
-        int Cin =  i       & 1;  // LSB
-
-        // Drive inputs
-        DriveInput(INPUT_A, A ? cLogic::LOGIC_HIGH : cLogic::LOGIC_LOW);
-        DriveInput(INPUT_B, B ? cLogic::LOGIC_HIGH : cLogic::LOGIC_LOW);
-        DriveInput(INPUT_CARRY, Cin ? cLogic::LOGIC_HIGH : cLogic::LOGIC_LOW);
+        int A   = (i >> 2) & 1;
+        int B   = (i >> 1) & 1;
+        int Cin =  i       & 1;
 
-        // Compute output if needed
-        ComputeOutput();
-
-        // Read outputs
-        int Sum  = GetOutputState(SUM_OUTPUT);
-        int Cout = GetOutputState(CARRY_OUTPUT);
+        // Read outputs for this row
+        const unsigned Row = A << INPUT_A | B << INPUT_B | Cin << INPUT_CARRY;
+        int Sum  = tTable::Get(Row, SUM_OUTPUT);
+        int Cout = tTable::Get(Row, CARRY_OUTPUT);
 
         // Print in ordered table
         std::cout << A << " " << B << "  " << Cin
-                  << "   |  " << Sum << "    " << Cout << std::endl;
+                  << "   |  " << Sum << "    " << Cout << "\n";
     }
 }
 
@@ -122,30 +165,69 @@ cThreeBitAdder::cThreeBitAdder() : cSubCircuit(/*inputs*/6, /*outputs*/4) {
 // Calls ComputeOutput to set initial output values.
 //---
 void cThreeBitAdder::ComputeOutput() {
-    // Compute the outputs for the 3-bit adder:
+    // Compute the outputs for the 3-bit adder, settling each stage once:
     // - Stage 0: LSB uses Half Adder on A0, B0
-    mHalfAdder.DriveInput(INPUT_A, mInputs[A0]);
-    mHalfAdder.DriveInput(INPUT_B, mInputs[B0]);
+    mHalfAdder.DriveInputs({ mInputs[A0], mInputs[B0] });
     cLogic::eLogicLevel s0   = mHalfAdder.GetOutputState(SUM_OUTPUT);    // from half adder
     cLogic::eLogicLevel c01  = mHalfAdder.GetOutputState(CARRY_OUTPUT);  // carry to next stage
-    mOutputValues[S0] = s0;
+    SetOutput(S0, s0);
 
     // - Stage 1: Full Adder on A1, B1 with Cin = c01
-    mFullAdder1.DriveInput(INPUT_A, mInputs[A1]);           // A1
-    mFullAdder1.DriveInput(INPUT_B, mInputs[B1]);           // B1
-    mFullAdder1.DriveInput(INPUT_CARRY, c01);                   // Cin from previous stage
+    mFullAdder1.DriveInputs({ mInputs[A1], mInputs[B1], c01 });
     cLogic::eLogicLevel s1   = mFullAdder1.GetOutputState(SUM_OUTPUT);
     cLogic::eLogicLevel c12  = mFullAdder1.GetOutputState(CARRY_OUTPUT);  // carry to next stage
-    mOutputValues[S1] = s1;
+    SetOutput(S1, s1);
 
     // - Stage 2 (MSB): Full Adder on A2, B2 with Cin = c12
-    mFullAdder2.DriveInput(INPUT_A, mInputs[A2]);           // A2
-    mFullAdder2.DriveInput(INPUT_B, mInputs[B2]);           // B2
-    mFullAdder2.DriveInput(INPUT_CARRY, c12);                   // Cin from previous stage
+    mFullAdder2.DriveInputs({ mInputs[A2], mInputs[B2], c12 });
     cLogic::eLogicLevel s2   = mFullAdder2.GetOutputState(SUM_OUTPUT);
     cLogic::eLogicLevel cout = mFullAdder2.GetOutputState(CARRY_OUTPUT);
-    mOutputValues[S2]  = s2;
-    mOutputValues[COUT]= cout;
+    SetOutput(S2, s2);
+    SetOutput(COUT, cout);
+}
+//---
+void cThreeBitAdder::ComputePacked( const cLogic::tPackedLevel* apInputs, cLogic::tPackedLevel* apOutputs ) {
+    // Same ripple chain as ComputeOutput, but each signal carries 64 vectors
+    cLogic::tPackedLevel Stage0[2], Stage1[2], Stage2[2];
+
+    cLogic::tPackedLevel HAIn[2] = { apInputs[A0], apInputs[B0] };
+    mHalfAdder.ComputePacked(HAIn, Stage0);
+
+    cLogic::tPackedLevel FA1In[3] = { apInputs[A1], apInputs[B1], Stage0[CARRY_OUTPUT] };
+    mFullAdder1.ComputePacked(FA1In, Stage1);
+
+    cLogic::tPackedLevel FA2In[3] = { apInputs[A2], apInputs[B2], Stage1[CARRY_OUTPUT] };
+    mFullAdder2.ComputePacked(FA2In, Stage2);
+
+    apOutputs[S0]   = Stage0[SUM_OUTPUT];
+    apOutputs[S1]   = Stage1[SUM_OUTPUT];
+    apOutputs[S2]   = Stage2[SUM_OUTPUT];
+    apOutputs[COUT] = Stage2[CARRY_OUTPUT];
+}
+//---
+bool cThreeBitAdder::Flatten( cNetlist& aNetlist, const int* apInputNets, int* apOutputNets ) const {
+    int Stage0[2], Stage1[2], Stage2[2];
+
+    int HAIn[2] = { apInputNets[A0], apInputNets[B0] };
+    if( !mHalfAdder.Flatten(aNetlist, HAIn, Stage0) ) return false;
+
+    int FA1In[3] = { apInputNets[A1], apInputNets[B1], Stage0[CARRY_OUTPUT] };
+    if( !mFullAdder1.Flatten(aNetlist, FA1In, Stage1) ) return false;
+
+    int FA2In[3] = { apInputNets[A2], apInputNets[B2], Stage1[CARRY_OUTPUT] };
+    if( !mFullAdder2.Flatten(aNetlist, FA2In, Stage2) ) return false;
+
+    apOutputNets[S0]   = Stage0[SUM_OUTPUT];
+    apOutputNets[S1]   = Stage1[SUM_OUTPUT];
+    apOutputNets[S2]   = Stage2[SUM_OUTPUT];
+    apOutputNets[COUT] = Stage2[CARRY_OUTPUT];
+    return true;
+}
+//---
+void cThreeBitAdder::ForEachChild( const std::function<void( cLogicGate&, const std::string& )>& aVisit ) {
+    aVisit(mHalfAdder, "ha");
+    aVisit(mFullAdder1, "fa1");
+    aVisit(mFullAdder2, "fa2");
 }
 //---
 void cThreeBitAdder::TestOutputs() {
@@ -154,23 +236,16 @@ void cThreeBitAdder::TestOutputs() {
     std::cout << "A2 A1 A0 | B2 B1 B0 || COUT S2 S1 S0\n";
     std::cout << "-------------------------------------\n";
 
-    // Iterate all 3-bit A and B values
+    // The compile-time table (static_circuits.hpp) has the A bits then the B bits as its row index
+    typedef cStaticTruthTable<cStaticRippleAdderCell<3>> tTable;
+    static_assert(A0 == 0 && B0 == 3 && S0 == 0 && COUT == 3, "cStaticRippleAdderCell pin order");
     for (int A = 0; A < 8; ++A) {
         for (int B = 0; B < 8; ++B) {
-            // Drive inputs (A2..A0, B2..B0)
-            DriveInput(A2, (A & 0b100) ? cLogic::LOGIC_HIGH : cLogic::LOGIC_LOW);
-            DriveInput(A1, (A & 0b010) ?  cLogic::LOGIC_HIGH :  cLogic::LOGIC_LOW);
-            DriveInput(A0, (A & 0b001) ?  cLogic::LOGIC_HIGH :  cLogic::LOGIC_LOW);
-
-            DriveInput(B2, (B & 0b100) ?  cLogic::LOGIC_HIGH :  cLogic::LOGIC_LOW);
-            DriveInput(B1, (B & 0b010) ?  cLogic::LOGIC_HIGH :  cLogic::LOGIC_LOW);
-            DriveInput(B0, (B & 0b001) ?  cLogic::LOGIC_HIGH :  cLogic::LOGIC_LOW);
-
-            // Read outputs (ComputeOutput() is already triggered by DriveInput/reads)
-            int s0   = GetOutputState(S0);
-            int s1   = GetOutputState(S1);
-            int s2   = GetOutputState(S2);
-            int cout = GetOutputState(COUT);
+            const std::uint32_t Row = tTable::GetRow(A | B << 3);
+            int s0   = (Row >> S0) & 1;
+            int s1   = (Row >> S1) & 1;
+            int s2   = (Row >> S2) & 1;
+            int cout = (Row >> COUT) & 1;
 
             std::cout
                 << ((A>>2)&1) << "  " << ((A>>1)&1) << "  " << (A&1)
@@ -187,16 +262,16 @@ void cThreeBitAdder::TestOutputs() {
 // Runs the simulation by creating a HalfAdder, testing its outputs, and cleaning up
 void cSimulation::RunSimulation() {
 
-    mptr[0] = new cNandGate;
-    mptr[1] = new cAndGate;
-    mptr[2] = new cOrGate;
-    mptr[3] = new cXorGate;
-    mptr[4] = new cHalfAdder;
-    mptr[5] = new cFullAdder;
-    mptr[6]= new cThreeBitAdder;
+    // Every gate comes from one arena block and is freed in one step when Arena goes out of scope
+    cNetlistArena Arena;
+    mptr[0] = Arena.Create<cNandGate>();
+    mptr[1] = Arena.Create<cAndGate>();
+    mptr[2] = Arena.Create<cOrGate>();
+    mptr[3] = Arena.Create<cXorGate>();
+    mptr[4] = Arena.Create<cHalfAdder>();
+    mptr[5] = Arena.Create<cFullAdder>();
+    mptr[6] = Arena.Create<cThreeBitAdder>();
 
-    for (auto p : mptr) {
+    for (auto p : mptr)
         p->TestOutputs();
-        delete p;
-    }
 }
\ No newline at end of file
@@ -3,6 +3,9 @@
 // Date Modified: 1st September 2025
 // Description: Header file for circuit-related class declarations (user file, content not specified).
 
+#ifndef CIRCUITS_HPP
+#define CIRCUITS_HPP
+
 #include "logic_gates.hpp" // Include logic gate definitions
 
 // Base class for all subcircuits, inherits from cLogicGate
@@ -10,6 +13,8 @@ class cSubCircuit : public cLogicGate {
     public:
         cSubCircuit(int aNumInputs, int aNumOutputs); // Constructor with input/output count
         virtual ~cSubCircuit() = default;
+
+        bool IsTruthTableCandidate() const override { return true; } // Small subcircuits may be tabulated
 };
 
 // Half Adder circuit, inherits from cSubCircuit
@@ -20,6 +25,9 @@ class cHalfAdder : public cSubCircuit{
 
         void TestOutputs() override; // Print all output combinations
         void ComputeOutput() override; // Compute outputs based on inputs
+        void ComputePacked( const cLogic::tPackedLevel* apInputs, cLogic::tPackedLevel* apOutputs ) override; // Bitwise evaluation of 64 vectors
+        bool Flatten( cNetlist& aNetlist, const int* apInputNets, int* apOutputNets ) const override; // Emits the internal gates into a netlist
+        void ForEachChild( const std::function<void( cLogicGate& aChild, const std::string& aName )>& aVisit ) override; // Visits the internal gates
 
     protected:
         cAndGate mAND; // AND gate for carry output
@@ -33,6 +41,9 @@ class cFullAdder : public cSubCircuit {
         virtual ~cFullAdder() {};
         
         void TestOutputs() override; // Print all output combinations
+        void ComputePacked( const cLogic::tPackedLevel* apInputs, cLogic::tPackedLevel* apOutputs ) override; // Bitwise evaluation of 64 vectors
+        bool Flatten( cNetlist& aNetlist, const int* apInputNets, int* apOutputNets ) const override; // Emits the internal gates into a netlist
+        void ForEachChild( const std::function<void( cLogicGate& aChild, const std::string& aName )>& aVisit ) override; // Visits the internal gates
 
     private:
         void ComputeOutput() override; // Compute outputs based on inputs
@@ -49,6 +60,9 @@ class cThreeBitAdder : public cSubCircuit {
         virtual ~cThreeBitAdder() {};
 
         void TestOutputs() override; // Print all output combinations
+        void ComputePacked( const cLogic::tPackedLevel* apInputs, cLogic::tPackedLevel* apOutputs ) override; // Bitwise evaluation of 64 vectors
+        bool Flatten( cNetlist& aNetlist, const int* apInputNets, int* apOutputNets ) const override; // Emits the internal gates into a netlist
+        void ForEachChild( const std::function<void( cLogicGate& aChild, const std::string& aName )>& aVisit ) override; // Visits the internal gates
 
     private:
         void ComputeOutput() override; // Compute outputs based on inputs
@@ -72,4 +86,6 @@ class cSimulation {
 
     private:
         cLogicGate* mptr[7]; // Array of Logic Gate pointers to show polymorphism 
-};
\ No newline at end of file
+};
+
+#endif // CIRCUITS_HPP
@@ -0,0 +1,150 @@
+// File: cycle_sim.cpp
+// Author: Dylan George
+// Date Modified: 17th October 2026
+// Description: Implementation file for cSequentialCircuit and cCycleSimulator.
+
+//--Includes-------------------------------------------------------------------
+#include "cycle_sim.hpp"
+#include <algorithm>
+
+//---cSequentialCircuit Implementation-----------------------------------------
+cSequentialCircuit::cSequentialCircuit() : mCompiled(false) {}
+//---
+int cSequentialCircuit::AddInput() {
+
+    const int Net = mLogic.AddInput();
+    mInputNets.push_back(Net);
+    return Net;
+}
+//---
+int cSequentialCircuit::AddGate( cNetlist::eOpcode aOpcode, int aInputA, int aInputB ) {
+    return mLogic.AddGate(aOpcode, aInputA, aInputB);
+}
+//---
+bool cSequentialCircuit::AddCircuit( const cLogicGate& aCircuit, const int* apInputNets, int* apOutputNets ) {
+    return aCircuit.Flatten(mLogic, apInputNets, apOutputNets);
+}
+//---
+int cSequentialCircuit::AddFlipFlop( bool aResetHigh ) {
+
+    mFlipFlops.push_back(cFlipFlop{ mLogic.AddInput(), -1, -1, -1, aResetHigh });
+    return GetNumFlipFlops() - 1;
+}
+//---
+bool cSequentialCircuit::Compile() {
+
+    if (mCompiled)
+        return true;
+    for (int f = 0; f < GetNumFlipFlops(); ++f) {
+        if (mFlipFlops[f].mDNet < 0) {
+            mError = "flip-flop " + std::to_string(f) + " has no D input";
+            return false;
+        }
+    }
+
+    // Every net the registers and outputs read becomes a netlist output, so Levelize renumbers it
+    for (int Net : mOutputNets)
+        mLogic.AddOutput(Net);
+    std::vector<int> InputNets(mInputNets);
+    for (const cFlipFlop& FlipFlop : mFlipFlops) {
+        InputNets.push_back(FlipFlop.mQNet);
+        mLogic.AddOutput(FlipFlop.mDNet);
+        if (FlipFlop.mEnableNet >= 0)
+            mLogic.AddOutput(FlipFlop.mEnableNet);
+        if (FlipFlop.mResetNet >= 0)
+            mLogic.AddOutput(FlipFlop.mResetNet);
+    }
+    if (!mLogic.Levelize()) {
+        mError = "combinational loop not broken by a flip-flop";
+        return false;
+    }
+
+    // Levelize keeps the inputs in the order they were added, as nets 0..NumInputs-1, and
+    // construction nets grow in that order too; the outputs come back in the order added
+    std::sort(InputNets.begin(), InputNets.end());
+    const auto Renumber = [&InputNets]( int aNet ) {
+        return static_cast<int>(std::lower_bound(InputNets.begin(), InputNets.end(), aNet) - InputNets.begin());
+    };
+    int Output = 0;
+    for (int& Net : mInputNets)
+        Net = Renumber(Net);
+    for (int& Net : mOutputNets)
+        Net = mLogic.GetOutput(Output++);
+    for (cFlipFlop& FlipFlop : mFlipFlops) {
+        FlipFlop.mQNet = Renumber(FlipFlop.mQNet);
+        FlipFlop.mDNet = mLogic.GetOutput(Output++);
+        if (FlipFlop.mEnableNet >= 0)
+            FlipFlop.mEnableNet = mLogic.GetOutput(Output++);
+        if (FlipFlop.mResetNet >= 0)
+            FlipFlop.mResetNet = mLogic.GetOutput(Output++);
+    }
+    mCompiled = true;
+    return true;
+}
+
+
+//---cCycleSimulator Implementation--------------------------------------------
+cCycleSimulator::cCycleSimulator( const cSequentialCircuit& aCircuit )
+    : mLogic(aCircuit.mLogic), mNets(aCircuit.mLogic.GetNumNets(), 0), mCurrent(0),
+      mInputNets(aCircuit.mInputNets), mOutputNets(aCircuit.mOutputNets), mCycle(0) {
+
+    for (const cSequentialCircuit::cFlipFlop& FlipFlop : aCircuit.mFlipFlops) {
+        mQNets.push_back(FlipFlop.mQNet);
+        mDNets.push_back(FlipFlop.mDNet);
+        mEnableNets.push_back(FlipFlop.mEnableNet);
+        mResetNets.push_back(FlipFlop.mResetNet);
+        mResetLevels.push_back(FlipFlop.mResetHigh ? ~cLogic::tPackedLevel(0) : 0);
+    }
+    mState[0].resize(mQNets.size());
+    mState[1].resize(mQNets.size());
+    Reset();
+}
+//---
+void cCycleSimulator::Reset() {
+
+    std::fill(mNets.begin(), mNets.end(), 0);
+    mCurrent = 0;
+    std::copy(mResetLevels.begin(), mResetLevels.end(), mState[0].begin());
+    mCycle = 0;
+}
+//---
+void cCycleSimulator::SetInputs( const cLogic::tPackedLevel* apLevels ) {
+
+    for (size_t i = 0; i < mInputNets.size(); ++i)
+        mNets[mInputNets[i]] = apLevels[i];
+}
+//---
+void cCycleSimulator::Step() {
+
+    const int NumFlipFlops = static_cast<int>(mQNets.size());
+    const cLogic::tPackedLevel* pState = mState[mCurrent].data();
+    cLogic::tPackedLevel* pNext = mState[mCurrent ^ 1].data();
+    cLogic::tPackedLevel* pNets = mNets.data();
+
+    // Settle the logic on the present state
+    for (int f = 0; f < NumFlipFlops; ++f)
+        pNets[mQNets[f]] = pState[f];
+    mLogic.EvaluateGates(pNets, 0, mLogic.GetNumGates());
+
+    // Clock edge: next state into the other buffer, then swap
+    for (int f = 0; f < NumFlipFlops; ++f) {
+        cLogic::tPackedLevel Next = pNets[mDNets[f]];
+        if (mEnableNets[f] >= 0) {
+            const cLogic::tPackedLevel Enable = pNets[mEnableNets[f]];
+            Next = (Next & Enable) | (pState[f] & ~Enable);
+        }
+        if (mResetNets[f] >= 0) {
+            const cLogic::tPackedLevel ResetMask = pNets[mResetNets[f]];
+            Next = (Next & ~ResetMask) | (mResetLevels[f] & ResetMask);
+        }
+        pNext[f] = Next;
+    }
+    mCurrent ^= 1;
+    ++mCycle;
+}
+//---
+void cCycleSimulator::Run( long long aCycles ) {
+
+    for (long long c = 0; c < aCycles; ++c)
+        Step();
+}
@@ -0,0 +1,113 @@
+// File: cycle_sim.hpp
+// Author: Dylan George
+// Date Modified: 17th October 2026
+// Description: Header file for synchronous sequential circuits (combinational logic plus D
+//              flip-flops on one clock) and cCycleSimulator, a cycle-based engine for them.
+
+#ifndef CYCLE_SIM_HPP
+#define CYCLE_SIM_HPP
+
+#include "netlist.hpp"
+#include <string>
+#include <vector>
+
+// cSequentialCircuit builds a single-clock design: a combinational netlist plus a bank of D
+// flip-flops with enable and synchronous reset, the cycle-level form of cDFlipFlop.
+// Each flip-flop's Q is an extra input of the netlist and its D, ENABLE and RESET are extra
+// outputs, so the combinational part is an ordinary levelized cNetlist and a loop through
+// a flip-flop is not a combinational loop.
+//
+// AddInput, AddGate, AddCircuit and GetQ return nets, and SetD, SetEnable, SetReset and
+// AddOutput take them. Build everything, then call Compile once; it renumbers every recorded
+// net to the levelized netlist's numbering, and the circuit must not change afterwards.
+class cSequentialCircuit {
+    public:
+        cSequentialCircuit(); // Constructor
+        ~cSequentialCircuit() {}
+
+        // Construction
+        int AddInput(); // Adds a primary input and returns its net
+        int AddGate( cNetlist::eOpcode aOpcode, int aInputA = -1, int aInputB = -1 ); // Adds a primitive and returns its output net
+        bool AddCircuit( const cLogicGate& aCircuit, const int* apInputNets, int* apOutputNets ); // Flattens a gate or subcircuit in; false if it cannot be flattened
+        int AddFlipFlop( bool aResetHigh = false ); // Adds a flip-flop (always enabled, never reset) and returns its index
+        int GetQ( int aFlipFlop ) const { return mFlipFlops[aFlipFlop].mQNet; } // Net driven by a flip-flop's output
+        void SetD( int aFlipFlop, int aNet ) { mFlipFlops[aFlipFlop].mDNet = aNet; }
+        void SetEnable( int aFlipFlop, int aNet ) { mFlipFlops[aFlipFlop].mEnableNet = aNet; } // -1: always enabled
+        void SetReset( int aFlipFlop, int aNet ) { mFlipFlops[aFlipFlop].mResetNet = aNet; }   // -1: never reset
+        void AddOutput( int aNet ) { mOutputNets.push_back(aNet); } // Marks a net as the next primary output
+        bool Compile(); // Levelizes the logic; false on a combinational loop or a flip-flop without D
+
+        bool IsCompiled() const { return mCompiled; }
+        const std::string& GetError() const { return mError; }
+
+        // Shape
+        int GetNumInputs() const { return static_cast<int>(mInputNets.size()); }
+        int GetNumOutputs() const { return static_cast<int>(mOutputNets.size()); }
+        int GetNumFlipFlops() const { return static_cast<int>(mFlipFlops.size()); }
+        const cNetlist& GetLogic() const { return mLogic; } // Combinational part, levelized once compiled
+
+    private:
+        // cFlipFlop: One register bit and where its pins connect
+        class cFlipFlop {
+            public:
+                int mQNet;          // Netlist input carrying Q
+                int mDNet;          // Net sampled into Q, -1 until SetD
+                int mEnableNet;     // Load when HIGH, -1 for always
+                int mResetNet;      // Load the reset level when HIGH, -1 for never
+                bool mResetHigh;    // Reset level
+        };
+
+        cNetlist mLogic;                        // Combinational logic, flip-flop pins as extra inputs and outputs
+        std::vector<int> mInputNets;            // Net of each primary input
+        std::vector<int> mOutputNets;           // Net of each primary output
+        std::vector<cFlipFlop> mFlipFlops;      // Register bank
+        bool mCompiled;                         // Compile succeeded
+        std::string mError;                     // Why Compile failed
+
+        friend class cCycleSimulator;
+};
+
+
+// cCycleSimulator runs a compiled cSequentialCircuit one clock cycle at a time, with no
+// events: each cycle evaluates the levelized logic once, in order, then every flip-flop
+// computes its next state (RESET ? reset level : ENABLE ? D : Q) into the second of two
+// state buffers, and the buffers swap. The next state is never written over the state the
+// logic read, so shift chains need no ordering between flip-flops.
+//
+// Values are packed: bit n of every input, output and state word belongs to an independent
+// copy of the machine, so one Step clocks 64 machines (e.g. 64 LFSR seeds) at once.
+class cCycleSimulator {
+    public:
+        explicit cCycleSimulator( const cSequentialCircuit& aCircuit ); // aCircuit must be compiled and outlive the simulator
+        cCycleSimulator( const cCycleSimulator& ) = delete;
+        cCycleSimulator& operator=( const cCycleSimulator& ) = delete;
+
+        void Reset(); // Every flip-flop to its reset level, inputs LOW, cycle 0
+        void SetState( int aFlipFlop, cLogic::tPackedLevel aState ) { mState[mCurrent][aFlipFlop] = aState; }
+        cLogic::tPackedLevel GetState( int aFlipFlop ) const { return mState[mCurrent][aFlipFlop]; } // Q after the last edge
+
+        void SetInput( int aInput, cLogic::tPackedLevel aLevel ) { mNets[mInputNets[aInput]] = aLevel; } // Held until set again
+        void SetInputs( const cLogic::tPackedLevel* apLevels ); // Every primary input, in order
+
+        void Step(); // One clock cycle: settle the logic, then the rising edge
+        void Run( long long aCycles ); // aCycles cycles with the inputs held
+
+        cLogic::tPackedLevel GetOutput( int aOutput ) const { return mNets[mOutputNets[aOutput]]; } // Settled before the last edge
+        long long GetCycle() const { return mCycle; } // Cycles stepped since Reset
+
+    private:
+        const cNetlist& mLogic;
+        std::vector<cLogic::tPackedLevel> mNets;        // Every net of the logic; primary inputs hold their levels here
+        std::vector<cLogic::tPackedLevel> mState[2];    // Flip-flop state, double-buffered
+        int mCurrent;                                   // Buffer holding the present state
+
+        // Connections as nets of the levelized logic, flip-flops in structure-of-arrays form
+        std::vector<int> mInputNets;                    // Net of each primary input
+        std::vector<int> mOutputNets;                   // Net of each primary output
+        std::vector<int> mQNets, mDNets, mEnableNets, mResetNets; // Per flip-flop, -1 where unconnected
+        std::vector<cLogic::tPackedLevel> mResetLevels; // Reset level of each flip-flop across the word
+
+        long long mCycle;
+};
+
+#endif // CYCLE_SIM_HPP
@@ -0,0 +1,206 @@
+// File: dual_rail.cpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Implementation file for dual-rail three-valued logic kernels (AVX2/SSE2/scalar).
+
+//--Includes-------------------------------------------------------------------
+#include "dual_rail.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define DUAL_RAIL_X86 1
+#endif
+
+//---Local helpers-------------------------------------------------------------
+namespace {
+
+// Every two-input primitive is AND, OR or XOR of the values, optionally inverted.
+// The unknown plane is always Xa | Xb, and the value plane is cleared wherever X is set.
+enum eBaseOp { BASE_AND, BASE_OR, BASE_XOR };
+
+bool gForceScalar = false; // Set by cDualRail::ForceScalar
+
+// Portable kernel, also used for the tail words the SIMD loops leave behind
+void ApplyScalar( eBaseOp aBase, std::uint64_t aInvert,
+                  const std::uint64_t* apVa, const std::uint64_t* apXa,
+                  const std::uint64_t* apVb, const std::uint64_t* apXb,
+                  std::uint64_t* apVo, std::uint64_t* apXo, size_t aFirst, size_t aWords ) {
+
+  for( size_t i=aFirst; i<aWords; ++i ) {
+    const std::uint64_t X = apXa[i] | apXb[i];
+    std::uint64_t V = 0;
+    switch( aBase ) {
+      case BASE_AND: V = apVa[i] & apVb[i]; break;
+      case BASE_OR:  V = apVa[i] | apVb[i]; break;
+      case BASE_XOR: V = apVa[i] ^ apVb[i]; break;
+    }
+    apVo[i] = ~X & (V ^ aInvert);
+    apXo[i] = X;
+  }
+}
+
+#ifdef DUAL_RAIL_X86
+// 128-bit kernel, two words per step; SSE2 is part of the x86-64 baseline
+size_t ApplySse2( eBaseOp aBase, std::uint64_t aInvert,
+                  const std::uint64_t* apVa, const std::uint64_t* apXa,
+                  const std::uint64_t* apVb, const std::uint64_t* apXb,
+                  std::uint64_t* apVo, std::uint64_t* apXo, size_t aWords ) {
+
+  const __m128i Invert = _mm_set1_epi64x(static_cast<long long>(aInvert));
+  size_t i = 0;
+  for( ; i + 2 <= aWords; i += 2 ) {
+    const __m128i Va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(apVa + i));
+    const __m128i Vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(apVb + i));
+    const __m128i X  = _mm_or_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(apXa + i)),
+                                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(apXb + i)));
+    __m128i V = (aBase == BASE_AND) ? _mm_and_si128(Va, Vb)
+              : (aBase == BASE_OR)  ? _mm_or_si128(Va, Vb)
+                                    : _mm_xor_si128(Va, Vb);
+    V = _mm_andnot_si128(X, _mm_xor_si128(V, Invert));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(apVo + i), V);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(apXo + i), X);
+  }
+  return i;
+}
+//---
+// 256-bit kernel, four words (256 lanes) per step; only called when the CPU reports AVX2
+__attribute__((target("avx2")))
+size_t ApplyAvx2( eBaseOp aBase, std::uint64_t aInvert,
+                  const std::uint64_t* apVa, const std::uint64_t* apXa,
+                  const std::uint64_t* apVb, const std::uint64_t* apXb,
+                  std::uint64_t* apVo, std::uint64_t* apXo, size_t aWords ) {
+
+  const __m256i Invert = _mm256_set1_epi64x(static_cast<long long>(aInvert));
+  size_t i = 0;
+  for( ; i + 4 <= aWords; i += 4 ) {
+    const __m256i Va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(apVa + i));
+    const __m256i Vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(apVb + i));
+    const __m256i X  = _mm256_or_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(apXa + i)),
+                                       _mm256_loadu_si256(reinterpret_cast<const __m256i*>(apXb + i)));
+    __m256i V = (aBase == BASE_AND) ? _mm256_and_si256(Va, Vb)
+              : (aBase == BASE_OR)  ? _mm256_or_si256(Va, Vb)
+                                    : _mm256_xor_si256(Va, Vb);
+    V = _mm256_andnot_si256(X, _mm256_xor_si256(V, Invert));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(apVo + i), V);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(apXo + i), X);
+  }
+  return i;
+}
+#endif
+
+// eKernel: Widest kernel available on this CPU, detected once
+enum eKernel { KERNEL_SCALAR, KERNEL_SSE2, KERNEL_AVX2 };
+
+eKernel DetectKernel() {
+#ifdef DUAL_RAIL_X86
+  __builtin_cpu_init();
+  if( __builtin_cpu_supports("avx2") )
+    return KERNEL_AVX2;
+  return KERNEL_SSE2;
+#else
+  return KERNEL_SCALAR;
+#endif
+}
+
+eKernel GetKernel() {
+  static const eKernel Kernel = DetectKernel();
+  return gForceScalar ? KERNEL_SCALAR : Kernel;
+}
+
+} // namespace
+
+
+//---cDualRailSignals Implementation-------------------------------------------
+cDualRailSignals::cDualRailSignals( int aNumSignals, int aWords ) : mNumSignals(0), mWords(0) {
+  Resize(aNumSignals, aWords);
+}
+//---
+void cDualRailSignals::Resize( int aNumSignals, int aWords ) {
+
+  mNumSignals = aNumSignals;
+  mWords = aWords;
+  mValue.assign(static_cast<size_t>(aNumSignals) * aWords, 0);
+  mUnknown.assign(static_cast<size_t>(aNumSignals) * aWords, ~std::uint64_t(0)); // Everything starts UNDEFINED
+}
+//---
+void cDualRailSignals::Set( int aSignal, int aLane, cLogic::eLogicLevel aLevel ) {
+
+  const std::uint64_t Bit = std::uint64_t(1) << (aLane % cLogic::PackedWidth);
+  std::uint64_t& V = Value(aSignal)[aLane / cLogic::PackedWidth];
+  std::uint64_t& X = Unknown(aSignal)[aLane / cLogic::PackedWidth];
+
+  V &= ~Bit;
+  X &= ~Bit;
+  if( aLevel == cLogic::LOGIC_UNDEFINED )
+    X |= Bit;
+  else if( aLevel == cLogic::LOGIC_HIGH )
+    V |= Bit;
+}
+//---
+cLogic::eLogicLevel cDualRailSignals::Get( int aSignal, int aLane ) const {
+
+  const int Shift = aLane % cLogic::PackedWidth;
+  if( (Unknown(aSignal)[aLane / cLogic::PackedWidth] >> Shift) & 1 )
+    return cLogic::LOGIC_UNDEFINED;
+  return ((Value(aSignal)[aLane / cLogic::PackedWidth] >> Shift) & 1) ? cLogic::LOGIC_HIGH : cLogic::LOGIC_LOW;
+}
+
+
+//---cDualRail Implementation--------------------------------------------------
+void cDualRail::Apply( cNetlist::eOpcode aOpcode,
+                       const std::uint64_t* apValueA, const std::uint64_t* apUnknownA,
+                       const std::uint64_t* apValueB, const std::uint64_t* apUnknownB,
+                       std::uint64_t* apValueOut, std::uint64_t* apUnknownOut, size_t aWords ) {
+
+  eBaseOp Base = BASE_AND;
+  std::uint64_t Invert = 0;
+  switch( aOpcode ) {
+    case cNetlist::OP_AND:  Base = BASE_AND; break;
+    case cNetlist::OP_OR:   Base = BASE_OR;  break;
+    case cNetlist::OP_XOR:  Base = BASE_XOR; break;
+    case cNetlist::OP_NAND: Base = BASE_AND; Invert = ~std::uint64_t(0); break;
+    case cNetlist::OP_NOR:  Base = BASE_OR;  Invert = ~std::uint64_t(0); break;
+    case cNetlist::OP_XNOR: Base = BASE_XOR; Invert = ~std::uint64_t(0); break;
+
+    // Single-input and constant primitives are rare; handle them word by word
+    case cNetlist::OP_NOT:
+    case cNetlist::OP_BUF:
+      Invert = (aOpcode == cNetlist::OP_NOT) ? ~std::uint64_t(0) : 0;
+      for( size_t i=0; i<aWords; ++i ) {
+        apUnknownOut[i] = apUnknownA[i];
+        apValueOut[i] = ~apUnknownA[i] & (apValueA[i] ^ Invert);
+      }
+      return;
+    case cNetlist::OP_CONST0:
+    case cNetlist::OP_CONST1:
+      for( size_t i=0; i<aWords; ++i ) {
+        apUnknownOut[i] = 0;
+        apValueOut[i] = (aOpcode == cNetlist::OP_CONST1) ? ~std::uint64_t(0) : 0;
+      }
+      return;
+  }
+
+  size_t Done = 0;
+#ifdef DUAL_RAIL_X86
+  switch( GetKernel() ) {
+    case KERNEL_AVX2: Done = ApplyAvx2(Base, Invert, apValueA, apUnknownA, apValueB, apUnknownB, apValueOut, apUnknownOut, aWords); break;
+    case KERNEL_SSE2: Done = ApplySse2(Base, Invert, apValueA, apUnknownA, apValueB, apUnknownB, apValueOut, apUnknownOut, aWords); break;
+    case KERNEL_SCALAR: break;
+  }
+#endif
+  ApplyScalar(Base, Invert, apValueA, apUnknownA, apValueB, apUnknownB, apValueOut, apUnknownOut, Done, aWords);
+}
+//---
+const char* cDualRail::GetKernelName() {
+
+  switch( GetKernel() ) {
+    case KERNEL_AVX2: return "avx2";
+    case KERNEL_SSE2: return "sse2";
+    default:          return "scalar";
+  }
+}
+//---
+void cDualRail::ForceScalar( bool aScalar ) {
+
+  gForceScalar = aScalar;
+}
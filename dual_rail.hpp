@@ -0,0 +1,59 @@
+// File: dual_rail.hpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Header file for dual-rail (value/unknown bit-plane) three-valued logic kernels.
+
+#ifndef DUAL_RAIL_HPP
+#define DUAL_RAIL_HPP
+
+#include "logic_gates.hpp"
+#include "netlist.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// cDualRailSignals stores many three-valued signals, each across Words*64 lanes, as two bit-planes:
+//   Unknown bit set          -> LOGIC_UNDEFINED (Value bit is kept 0)
+//   Unknown clear, Value set -> LOGIC_HIGH
+//   both clear               -> LOGIC_LOW
+// A lane is usually one stimulus vector, so one kernel call evaluates a gate for every lane.
+class cDualRailSignals {
+    public:
+        cDualRailSignals( int aNumSignals = 0, int aWords = 1 ); // All lanes start UNDEFINED
+        void Resize( int aNumSignals, int aWords ); // Resets every lane to UNDEFINED
+
+        void Set( int aSignal, int aLane, cLogic::eLogicLevel aLevel ); // Writes one lane of one signal
+        cLogic::eLogicLevel Get( int aSignal, int aLane ) const;      // Reads one lane of one signal
+
+        int GetNumSignals() const { return mNumSignals; }
+        int GetWords() const { return mWords; }   // 64-lane words per signal
+        int GetLanes() const { return mWords * cLogic::PackedWidth; }
+
+        std::uint64_t* Value( int aSignal ) { return &mValue[static_cast<size_t>(aSignal) * mWords]; }
+        std::uint64_t* Unknown( int aSignal ) { return &mUnknown[static_cast<size_t>(aSignal) * mWords]; }
+        const std::uint64_t* Value( int aSignal ) const { return &mValue[static_cast<size_t>(aSignal) * mWords]; }
+        const std::uint64_t* Unknown( int aSignal ) const { return &mUnknown[static_cast<size_t>(aSignal) * mWords]; }
+
+    private:
+        int mNumSignals;                    // Number of signals stored
+        int mWords;                         // Words per signal in each plane
+        std::vector<std::uint64_t> mValue;   // Value plane, signal-major
+        std::vector<std::uint64_t> mUnknown; // Unknown (X) plane, signal-major
+};
+
+
+// cDualRail applies one primitive over whole bit-planes with the widest kernel the CPU supports
+// (AVX2, then SSE2, then portable 64-bit words). Semantics match the gate classes exactly:
+// any UNDEFINED input makes the output UNDEFINED, otherwise the usual boolean result.
+class cDualRail {
+    public:
+        static void Apply( cNetlist::eOpcode aOpcode,
+                           const std::uint64_t* apValueA, const std::uint64_t* apUnknownA,
+                           const std::uint64_t* apValueB, const std::uint64_t* apUnknownB,
+                           std::uint64_t* apValueOut, std::uint64_t* apUnknownOut, size_t aWords );
+
+        static const char* GetKernelName(); // "avx2", "sse2" or "scalar"
+        static void ForceScalar( bool aScalar ); // Use the portable kernels even if SIMD is available
+};
+
+#endif // DUAL_RAIL_HPP
@@ -0,0 +1,41 @@
+// File: event_scheduler.cpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Implementation file for the event-driven gate scheduler.
+
+//--Includes-------------------------------------------------------------------
+#include "event_scheduler.hpp"
+#include "gate_profiler.hpp"
+
+//---cEventScheduler Implementation--------------------------------------------
+cEventScheduler::cEventScheduler() : mEvaluations(0), mLastDepth(0) {}
+//---
+void cEventScheduler::Schedule( cLogicGate* apGate ) {
+
+  if( apGate->mScheduled )
+    return; // Already pending; it will see every input change when it runs
+
+  apGate->mScheduled = true;
+  mNext.push_back(apGate);
+}
+//---
+long long cEventScheduler::Run() {
+
+  const long long Start = mEvaluations;
+  mLastDepth = 0;
+
+  // Each wave evaluates the gates whose inputs toggled in the previous one
+  while( !mNext.empty() ) {
+    mCurrent.swap(mNext);
+    ++mLastDepth;
+
+    for( cLogicGate* pGate : mCurrent ) {
+      pGate->mScheduled = false; // Clear first so a self-feeding gate can queue again
+      pGate->Evaluate();
+      ++mEvaluations;
+    }
+    mCurrent.clear();
+  }
+  LOGICSIM_PROFILE_WAVES( mLastDepth );
+  return mEvaluations - Start;
+}
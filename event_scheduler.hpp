@@ -0,0 +1,34 @@
+// File: event_scheduler.hpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Header file for the event-driven (selective-trace) gate scheduler.
+
+#ifndef EVENT_SCHEDULER_HPP
+#define EVENT_SCHEDULER_HPP
+
+#include "logic_gates.hpp"
+#include <vector>
+
+// cEventScheduler queues gates whose inputs toggled and evaluates each one once per wave.
+// Gates attached with cLogicGate::SetScheduler no longer recurse through their output wires:
+// a changed input only enqueues the gate, and Run() drains the queue until nothing changes.
+class cEventScheduler {
+    public:
+        cEventScheduler(); // Constructor
+        ~cEventScheduler() {}
+
+        void Schedule( cLogicGate* apGate ); // Queues a gate for evaluation unless it is already queued
+        long long Run(); // Evaluates queued gates until the circuit settles; returns the evaluations performed
+
+        bool IsIdle() const { return mCurrent.empty() && mNext.empty(); } // No pending events
+        long long GetEvaluations() const { return mEvaluations; } // Total gate evaluations since construction
+        int GetLastDepth() const { return mLastDepth; } // Number of waves the last Run() needed to settle
+
+    private:
+        std::vector<cLogicGate*> mCurrent; // Gates being evaluated in this wave
+        std::vector<cLogicGate*> mNext;    // Gates scheduled by this wave, evaluated in the next
+        long long mEvaluations;            // Running count of ComputeOutput calls made
+        int mLastDepth;                    // Waves needed by the last Run()
+};
+
+#endif // EVENT_SCHEDULER_HPP
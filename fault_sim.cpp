@@ -0,0 +1,199 @@
+// File: fault_sim.cpp
+// Author: Dylan George
+// Date Modified: 17th October 2026
+// Description: Implementation file for cFaultSimulator.
+
+//--Includes-------------------------------------------------------------------
+#include "fault_sim.hpp"
+#include <algorithm>
+
+//---cFaultSimulator Implementation--------------------------------------------
+cFaultSimulator::cFaultSimulator( const cNetlist& aNetlist )
+    : mNetlist(aNetlist), mNumVectors(0), mNumWords(0), mNumGateEvaluations(0) {
+
+    const int NumNets = mNetlist.GetNumNets();
+    const int NumGates = mNetlist.GetNumGates();
+
+    // Fanout of each net: gate pins reading it plus primary outputs
+    std::vector<int> Fanout(NumNets, 0);
+    mFirstReader.assign(NumNets, NumGates);
+    for (int g = 0; g < NumGates; ++g) {
+        const int NumPins = cNetlist::GetOpcodeInputs(mNetlist.GetOpcode(g));
+        for (int Pin = 0; Pin < NumPins; ++Pin) {
+            const int Net = Pin == 0 ? mNetlist.GetInputA(g) : mNetlist.GetInputB(g);
+            ++Fanout[Net];
+            mFirstReader[Net] = std::min(mFirstReader[Net], g);
+        }
+    }
+    for (int o = 0; o < mNetlist.GetNumOutputs(); ++o)
+        ++Fanout[mNetlist.GetOutput(o)];
+
+    for (int Net = 0; Net < NumNets; ++Net) {
+        mFaults.push_back(cFault{ Net, -1, 0, false, -1 });
+        mFaults.push_back(cFault{ Net, -1, 0, true, -1 });
+    }
+    for (int g = 0; g < NumGates; ++g) {
+        const int NumPins = cNetlist::GetOpcodeInputs(mNetlist.GetOpcode(g));
+        for (int Pin = 0; Pin < NumPins; ++Pin) {
+            const int Net = Pin == 0 ? mNetlist.GetInputA(g) : mNetlist.GetInputB(g);
+            if (Fanout[Net] > 1) {
+                mFaults.push_back(cFault{ Net, g, Pin, false, -1 });
+                mFaults.push_back(cFault{ Net, g, Pin, true, -1 });
+            }
+        }
+    }
+
+    mGood.assign(NumNets, 0);
+    mBroadcast.assign(NumNets, 0);
+    mFaulty.assign(NumNets, 0);
+    mInject.assign(NumGates, 0);
+    mNetForce0.assign(NumNets, 0);
+    mNetForce1.assign(NumNets, 0);
+    mPinForce0.assign(2 * static_cast<size_t>(NumGates), 0);
+    mPinForce1.assign(2 * static_cast<size_t>(NumGates), 0);
+    Reset();
+}
+//---
+void cFaultSimulator::Reset() {
+    mUndetected.resize(mFaults.size());
+    for (size_t f = 0; f < mFaults.size(); ++f) {
+        mFaults[f].mDetectedBy = -1;
+        mUndetected[f] = static_cast<int>(f);
+    }
+    mNumVectors = 0;
+    mNumWords = 0;
+    mNumGateEvaluations = 0;
+}
+//---
+int cFaultSimulator::GetSiteGate( const cFault& aFault ) const {
+    if (aFault.mGate >= 0)
+        return aFault.mGate;
+    const int NumInputs = mNetlist.GetNumInputs();
+    return aFault.mNet < NumInputs ? mFirstReader[aFault.mNet] : aFault.mNet - NumInputs; // Input faults start at their first reader
+}
+//---
+std::string cFaultSimulator::Describe( const cFault& aFault ) const {
+    const std::string Stuck = aFault.mStuckAt1 ? " stuck-at-1" : " stuck-at-0";
+    if (aFault.mGate < 0)
+        return "net " + std::to_string(aFault.mNet) + Stuck;
+    return "gate " + std::to_string(aFault.mGate) + " input " + (aFault.mPin == 0 ? "A" : "B")
+         + " (net " + std::to_string(aFault.mNet) + ")" + Stuck;
+}
+//---
+void cFaultSimulator::Simulate( const cLogic::tPackedLevel* apInputs, int aNumVectors ) {
+    const int NumInputs = mNetlist.GetNumInputs();
+    const int NumNets = mNetlist.GetNumNets();
+    aNumVectors = std::min(aNumVectors, static_cast<int>(cLogic::PackedWidth));
+
+    // Good machine for the whole block at once
+    std::copy(apInputs, apInputs + NumInputs, mGood.begin());
+    mNetlist.EvaluateGates(mGood.data(), 0, mNetlist.GetNumGates());
+
+    for (int v = 0; v < aNumVectors && !mUndetected.empty(); ++v) {
+        for (int Net = 0; Net < NumNets; ++Net)
+            mBroadcast[Net] = cLogic::tPackedLevel(0) - ((mGood[Net] >> v) & 1);
+
+        // A fault can only be seen on a vector that drives its site to the other value
+        mActive.clear();
+        for (int f : mUndetected) {
+            const cFault& Fault = mFaults[f];
+            if ((mBroadcast[Fault.mNet] & 1) != static_cast<cLogic::tPackedLevel>(Fault.mStuckAt1))
+                mActive.push_back(f);
+        }
+
+        for (size_t First = 0; First < mActive.size(); First += cLogic::PackedWidth) {
+            const int Count = static_cast<int>(std::min<size_t>(cLogic::PackedWidth, mActive.size() - First));
+            SimulateWord(&mActive[First], Count, mNumVectors + v);
+        }
+
+        // Drop what this vector detected
+        mUndetected.erase(std::remove_if(mUndetected.begin(), mUndetected.end(),
+                                         [this]( int f ) { return mFaults[f].mDetectedBy >= 0; }),
+                          mUndetected.end());
+    }
+    mNumVectors += aNumVectors;
+}
+//---
+void cFaultSimulator::SimulateWord( const int* apFaults, int aCount, long long aVector ) {
+    const int NumInputs = mNetlist.GetNumInputs();
+    const int NumGates = mNetlist.GetNumGates();
+
+    int FirstGate = NumGates;
+    for (int k = 0; k < aCount; ++k)
+        FirstGate = std::min(FirstGate, GetSiteGate(mFaults[apFaults[k]]));
+
+    // Nets before the first touched gate are the good machine's, except for faulty inputs
+    std::copy(mBroadcast.begin(), mBroadcast.begin() + NumInputs + FirstGate, mFaulty.begin());
+
+    for (int k = 0; k < aCount; ++k) {
+        const cFault& Fault = mFaults[apFaults[k]];
+        const cLogic::tPackedLevel Bit = cLogic::tPackedLevel(1) << k;
+        if (Fault.mGate >= 0) {
+            const size_t Pin = 2 * static_cast<size_t>(Fault.mGate) + Fault.mPin;
+            mInject[Fault.mGate] |= Fault.mPin == 0 ? INJECT_A : INJECT_B;
+            (Fault.mStuckAt1 ? mPinForce1 : mPinForce0)[Pin] |= Bit;
+        }
+        else if (Fault.mNet < NumInputs) {
+            mFaulty[Fault.mNet] = Fault.mStuckAt1 ? mFaulty[Fault.mNet] | Bit : mFaulty[Fault.mNet] & ~Bit;
+        }
+        else {
+            mInject[Fault.mNet - NumInputs] |= INJECT_OUTPUT;
+            (Fault.mStuckAt1 ? mNetForce1 : mNetForce0)[Fault.mNet] |= Bit;
+        }
+    }
+
+    for (int g = FirstGate; g < NumGates; ++g) {
+        const int InA = mNetlist.GetInputA(g);
+        const int InB = mNetlist.GetInputB(g);
+        cLogic::tPackedLevel A = mFaulty[InA >= 0 ? InA : 0];
+        cLogic::tPackedLevel B = mFaulty[InB >= 0 ? InB : 0];
+        const std::uint8_t Inject = mInject[g];
+        if (Inject & INJECT_A)
+            A = (A & ~mPinForce0[2 * static_cast<size_t>(g)]) | mPinForce1[2 * static_cast<size_t>(g)];
+        if (Inject & INJECT_B)
+            B = (B & ~mPinForce0[2 * static_cast<size_t>(g) + 1]) | mPinForce1[2 * static_cast<size_t>(g) + 1];
+
+        cLogic::tPackedLevel Out = 0;
+        switch (mNetlist.GetOpcode(g)) {
+            case cNetlist::OP_AND:    Out = A & B;    break;
+            case cNetlist::OP_OR:     Out = A | B;    break;
+            case cNetlist::OP_XOR:    Out = A ^ B;    break;
+            case cNetlist::OP_NAND:   Out = ~(A & B); break;
+            case cNetlist::OP_NOR:    Out = ~(A | B); break;
+            case cNetlist::OP_XNOR:   Out = ~(A ^ B); break;
+            case cNetlist::OP_NOT:    Out = ~A;       break;
+            case cNetlist::OP_BUF:    Out = A;        break;
+            case cNetlist::OP_CONST0: Out = 0;        break;
+            case cNetlist::OP_CONST1: Out = ~cLogic::tPackedLevel(0); break;
+        }
+        const int Net = NumInputs + g;
+        if (Inject & INJECT_OUTPUT)
+            Out = (Out & ~mNetForce0[Net]) | mNetForce1[Net];
+        mFaulty[Net] = Out;
+    }
+    ++mNumWords;
+    mNumGateEvaluations += NumGates - FirstGate;
+
+    cLogic::tPackedLevel Detected = 0;
+    for (int o = 0; o < mNetlist.GetNumOutputs(); ++o) {
+        const int Net = mNetlist.GetOutput(o);
+        Detected |= mFaulty[Net] ^ mBroadcast[Net];
+    }
+
+    // Record detections and clear the injections for the next word
+    for (int k = 0; k < aCount; ++k) {
+        cFault& Fault = mFaults[apFaults[k]];
+        if ((Detected >> k) & 1)
+            Fault.mDetectedBy = aVector;
+        if (Fault.mGate >= 0) {
+            mInject[Fault.mGate] = 0;
+            mPinForce0[2 * static_cast<size_t>(Fault.mGate) + Fault.mPin] = 0;
+            mPinForce1[2 * static_cast<size_t>(Fault.mGate) + Fault.mPin] = 0;
+        }
+        else if (Fault.mNet >= NumInputs) {
+            mInject[Fault.mNet - NumInputs] = 0;
+            mNetForce0[Fault.mNet] = 0;
+            mNetForce1[Fault.mNet] = 0;
+        }
+    }
+}
@@ -0,0 +1,87 @@
+// File: fault_sim.hpp
+// Author: Dylan George
+// Date Modified: 17th October 2026
+// Description: Header file for cFaultSimulator, parallel-fault stuck-at fault simulation of a
+//              compiled netlist with fault dropping and coverage reporting.
+
+#ifndef FAULT_SIM_HPP
+#define FAULT_SIM_HPP
+
+#include "netlist.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// cFaultSimulator grades a vector set against every single stuck-at fault of a compiled
+// (levelized) netlist. The fault list has a stuck-at-0 and a stuck-at-1 on every net (the
+// wire, or stem) and on every gate input pin fed by a net with fanout. A pin on a fanout-free
+// net is the same fault as the net itself, so it is listed once, as the net.
+//
+// Vectors are applied one at a time. For each one the good machine is evaluated once, and the
+// undetected faults the vector activates (the good value differs from the stuck value) are
+// packed 64 per word: bit k of every net is the circuit with fault k injected. Evaluation of a
+// word starts at the first gate any of its faults touches, since everything before it matches
+// the good machine. A fault is detected when a primary output differs from the good machine's,
+// and is then dropped: it is never simulated again.
+class cFaultSimulator {
+    public:
+        // cFault: One stuck-at fault and what the vectors did to it
+        class cFault {
+            public:
+                int mNet;                   // Net the fault sits on
+                int mGate;                  // Gate whose input pin is stuck, -1 for the net itself
+                int mPin;                   // Input pin of mGate (0 = A, 1 = B)
+                bool mStuckAt1;             // Stuck-at-1, else stuck-at-0
+                long long mDetectedBy;      // Index of the first vector that detects it, -1 while undetected
+        };
+
+        explicit cFaultSimulator( const cNetlist& aNetlist ); // Enumerates the faults; aNetlist must be levelized, outlive the simulator and not change
+        cFaultSimulator( const cFaultSimulator& ) = delete;
+        cFaultSimulator& operator=( const cFaultSimulator& ) = delete;
+
+        void Simulate( const cLogic::tPackedLevel* apInputs, int aNumVectors ); // Applies up to 64 vectors, one word per input, vector v in bit v
+        void Reset(); // Marks every fault undetected again
+
+        const std::vector<cFault>& GetFaults() const { return mFaults; }
+        std::string Describe( const cFault& aFault ) const; // e.g. "net 12 stuck-at-0", "gate 7 input B (net 3) stuck-at-1"
+
+        // Totals since construction or Reset
+        int GetNumFaults() const { return static_cast<int>(mFaults.size()); }
+        int GetNumDetected() const { return GetNumFaults() - static_cast<int>(mUndetected.size()); }
+        double GetCoverage() const { return mFaults.empty() ? 1.0 : static_cast<double>(GetNumDetected()) / GetNumFaults(); }
+        long long GetNumVectors() const { return mNumVectors; }             // Vectors applied
+        long long GetNumWords() const { return mNumWords; }                 // 64-fault words simulated
+        long long GetNumGateEvaluations() const { return mNumGateEvaluations; } // Gate evaluations over all words
+
+    private:
+        // Injection flags per gate
+        enum : std::uint8_t {
+            INJECT_OUTPUT = 1,  // A net fault on the gate's output
+            INJECT_A = 2,       // A pin fault on input A
+            INJECT_B = 4        // A pin fault on input B
+        };
+
+        int GetSiteGate( const cFault& aFault ) const; // First gate a fault's injection affects
+        void SimulateWord( const int* apFaults, int aCount, long long aVector ); // Up to 64 activated faults against the current vector
+
+        const cNetlist& mNetlist;                   // Circuit under test
+        std::vector<cFault> mFaults;                // Fault list, nets first then pins
+        std::vector<int> mUndetected;               // Indices into mFaults not yet detected
+        std::vector<int> mActive;                   // Undetected faults the current vector activates
+        std::vector<int> mFirstReader;              // First gate reading each net (number of gates if none)
+
+        std::vector<cLogic::tPackedLevel> mGood;    // Good machine, 64 vectors per net
+        std::vector<cLogic::tPackedLevel> mBroadcast; // Good machine for the current vector, replicated across the word
+        std::vector<cLogic::tPackedLevel> mFaulty;  // Faulty machines, one per bit
+
+        // Injection masks for the word being simulated: a forced value is (v & ~Force0) | Force1
+        std::vector<std::uint8_t> mInject;          // INJECT_ flags per gate
+        std::vector<cLogic::tPackedLevel> mNetForce0, mNetForce1;   // Per net
+        std::vector<cLogic::tPackedLevel> mPinForce0, mPinForce1;   // Per gate pin, 2 * gate + pin
+
+        long long mNumVectors;
+        long long mNumWords;
+        long long mNumGateEvaluations;
+};
+
+#endif // FAULT_SIM_HPP
@@ -0,0 +1,186 @@
+// File: gate_network.cpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Implementation file for cGateNetwork.
+
+//--Includes-------------------------------------------------------------------
+#include "gate_network.hpp"
+#include "netlist.hpp"
+
+//---cGateNetwork Implementation-----------------------------------------------
+cGateNetwork::cGateNetwork(int aNumInputs, int aNumOutputs)
+    : cSubCircuit(aNumInputs, aNumOutputs),
+      mOutputWires(aNumOutputs, -1),
+      mFinalized(false) {
+
+    mPinStart.push_back(0);
+    for (int i = 0; i < aNumInputs; ++i)
+        AddWire(); // Wire i carries primary input i
+}
+//---
+int cGateNetwork::AddWire() {
+    mWires.push_back(mArena.Create<cWire>());
+    mWireDriver.push_back(-1);
+    return GetNumWires() - 1;
+}
+//---
+int cGateNetwork::AddGate( cLogicGate* apGate, const int* apInputWires, int aNumInputWires, const int* apOutputWires, int aNumOutputWires ) {
+    mHeapGates.emplace_back(apGate);
+    return Connect(apGate, apInputWires, aNumInputWires, apOutputWires, aNumOutputWires);
+}
+//---
+int cGateNetwork::AddGate( cLogicGate* apGate, std::initializer_list<int> aInputWires, std::initializer_list<int> aOutputWires ) {
+    return AddGate(apGate, aInputWires.begin(), static_cast<int>(aInputWires.size()),
+                   aOutputWires.begin(), static_cast<int>(aOutputWires.size()));
+}
+//---
+int cGateNetwork::Connect( cLogicGate* apGate, const int* apInputWires, int aNumInputWires, const int* apOutputWires, int aNumOutputWires ) {
+    const int Gate = GetNumGates();
+    mGates.push_back(apGate);
+    mGateOrder.clear(); // Order must be rebuilt to include the new gate
+    mFinalized = false;  // New connections are outside the packed fanout table
+
+    // Gate is evaluated from the network's queue rather than recursively from its input wires
+    apGate->SetScheduler(&mScheduler);
+
+    for (int Pin = 0; Pin < aNumInputWires; ++Pin) {
+        mWires[apInputWires[Pin]]->AddOutputConnection(apGate, Pin);
+        mPinWires.push_back(apInputWires[Pin]);
+    }
+    for (int Pin = 0; Pin < aNumOutputWires; ++Pin) {
+        if (apOutputWires[Pin] >= 0) {
+            apGate->ConnectOutput(Pin, mWires[apOutputWires[Pin]]);
+            mWireDriver[apOutputWires[Pin]] = Gate;
+        }
+        mPinWires.push_back(apOutputWires[Pin]);
+    }
+    mPinStart.push_back(static_cast<int>(mPinWires.size()));
+
+    mScheduler.Schedule(apGate); // Evaluate once so gates with fixed outputs settle
+    return Gate;
+}
+//---
+void cGateNetwork::SetOutputWire( int aOutputIndex, int aWire ) {
+    mOutputWires[aOutputIndex] = aWire;
+}
+//---
+void cGateNetwork::Finalize() {
+    mFanoutTable.Build(mWires);
+    mFinalized = true;
+}
+//---
+void cGateNetwork::ComputeOutput() {
+    if (!mFinalized)
+        Finalize();
+
+    // Only wires whose level changes forward anything, so untouched inputs cost nothing downstream
+    for (int i = 0; i < GetNumInputs(); ++i)
+        mWires[i]->DriveLevel(mInputs[i]);
+
+    mScheduler.Run();
+
+    for (int o = 0; o < GetNumOutputs(); ++o)
+        SetOutput(o, mOutputWires[o] >= 0 ? mWires[mOutputWires[o]]->GetLevel() : cLogic::LOGIC_UNDEFINED);
+}
+//---
+const std::vector<int>& cGateNetwork::GetGateOrder() const {
+    if (static_cast<int>(mGateOrder.size()) == GetNumGates())
+        return mGateOrder;
+
+    // Kahn's algorithm over gate-to-gate dependencies through the wires
+    const int NumGates = GetNumGates();
+    std::vector<int> Pending(NumGates, 0);
+    std::vector<std::vector<int>> Loads(NumGates);
+    for (int g = 0; g < NumGates; ++g) {
+        for (int p = mPinStart[g]; p < mPinStart[g] + mGates[g]->GetNumInputs(); ++p) {
+            const int Driver = mWireDriver[mPinWires[p]];
+            if (Driver >= 0) {
+                ++Pending[g];
+                Loads[Driver].push_back(g);
+            }
+        }
+    }
+
+    mGateOrder.clear();
+    for (int g = 0; g < NumGates; ++g) {
+        if (Pending[g] == 0)
+            mGateOrder.push_back(g);
+    }
+    for (size_t i = 0; i < mGateOrder.size(); ++i) {
+        for (int Load : Loads[mGateOrder[i]]) {
+            if (--Pending[Load] == 0)
+                mGateOrder.push_back(Load);
+        }
+    }
+    return mGateOrder; // Shorter than NumGates if the network has a combinational loop
+}
+//---
+void cGateNetwork::ComputePacked( const cLogic::tPackedLevel* apInputs, cLogic::tPackedLevel* apOutputs ) {
+    const std::vector<int>& Order = GetGateOrder();
+    mPackedWires.assign(GetNumWires(), 0);
+    for (int i = 0; i < GetNumInputs(); ++i)
+        mPackedWires[i] = apInputs[i];
+
+    std::vector<cLogic::tPackedLevel> In, Out;
+    for (int g : Order) {
+        cLogicGate& Gate = *mGates[g];
+        const int* pPins = &mPinWires[mPinStart[g]];
+        In.resize(Gate.GetNumInputs());
+        Out.resize(Gate.GetNumOutputs());
+
+        for (int i = 0; i < Gate.GetNumInputs(); ++i)
+            In[i] = mPackedWires[pPins[i]];
+        Gate.ComputePacked(In.data(), Out.data());
+        for (int o = 0; o < Gate.GetNumOutputs(); ++o) {
+            const int Wire = pPins[Gate.GetNumInputs() + o];
+            if (Wire >= 0)
+                mPackedWires[Wire] = Out[o];
+        }
+    }
+
+    for (int o = 0; o < GetNumOutputs(); ++o)
+        apOutputs[o] = mOutputWires[o] >= 0 ? mPackedWires[mOutputWires[o]] : 0;
+}
+//---
+bool cGateNetwork::Flatten( cNetlist& aNetlist, const int* apInputNets, int* apOutputNets ) const {
+    const std::vector<int>& Order = GetGateOrder();
+    if (static_cast<int>(Order.size()) != GetNumGates())
+        return false; // Combinational loop cannot be flattened
+
+    std::vector<int> WireNet(GetNumWires(), -1);
+    for (int i = 0; i < GetNumInputs(); ++i)
+        WireNet[i] = apInputNets[i];
+
+    std::vector<int> In, Out;
+    for (int g : Order) {
+        const cLogicGate& Gate = *mGates[g];
+        const int* pPins = &mPinWires[mPinStart[g]];
+        In.resize(Gate.GetNumInputs());
+        Out.assign(Gate.GetNumOutputs(), -1);
+
+        for (int i = 0; i < Gate.GetNumInputs(); ++i) {
+            In[i] = WireNet[pPins[i]];
+            if (In[i] < 0)
+                return false; // Undriven wire
+        }
+        if (!Gate.Flatten(aNetlist, In.data(), Out.data()))
+            return false;
+        for (int o = 0; o < Gate.GetNumOutputs(); ++o) {
+            const int Wire = pPins[Gate.GetNumInputs() + o];
+            if (Wire >= 0)
+                WireNet[Wire] = Out[o];
+        }
+    }
+
+    for (int o = 0; o < GetNumOutputs(); ++o) {
+        if (mOutputWires[o] < 0 || WireNet[mOutputWires[o]] < 0)
+            return false; // Output is not driven
+        apOutputNets[o] = WireNet[mOutputWires[o]];
+    }
+    return true;
+}
+//---
+void cGateNetwork::ForEachChild( const std::function<void( cLogicGate&, const std::string& )>& aVisit ) {
+    for (int g = 0; g < GetNumGates(); ++g)
+        aVisit(*mGates[g], "g" + std::to_string(g));
+}
@@ -0,0 +1,70 @@
+// File: gate_network.hpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Header file for cGateNetwork, a subcircuit assembled at run time from gates and wires.
+
+#ifndef GATE_NETWORK_HPP
+#define GATE_NETWORK_HPP
+
+#include "arena.hpp"
+#include "circuits.hpp"
+#include "event_scheduler.hpp"
+#include <initializer_list>
+#include <memory>
+#include <vector>
+
+// cGateNetwork owns a set of gates connected by cWires and evaluates them event-driven:
+// only gates whose inputs actually toggle are re-evaluated, through a shared cEventScheduler.
+// Wires are referred to by index; wires 0..NumInputs-1 are driven by the primary inputs.
+// Wires, and gates created through CreateGate, are allocated from one cNetlistArena and
+// freed together with the network.
+class cGateNetwork : public cSubCircuit {
+    public:
+        cGateNetwork(int aNumInputs, int aNumOutputs); // Constructor, creates one wire per primary input
+        virtual ~cGateNetwork() {}
+
+        int AddWire(); // Creates an internal wire and returns its index
+        int AddGate( cLogicGate* apGate, const int* apInputWires, int aNumInputWires, const int* apOutputWires, int aNumOutputWires ); // Takes ownership of a heap gate, wires it up and returns its index
+        int AddGate( cLogicGate* apGate, std::initializer_list<int> aInputWires, std::initializer_list<int> aOutputWires ); // As above, wire lists inline
+
+        // Constructs a tGate in the network's arena, then connects it as AddGate does
+        template<class tGate, class... tArgs>
+        int CreateGate( std::initializer_list<int> aInputWires, std::initializer_list<int> aOutputWires, tArgs&&... aArgs ) {
+            return Connect(mArena.Create<tGate>(std::forward<tArgs>(aArgs)...), aInputWires.begin(), static_cast<int>(aInputWires.size()),
+                           aOutputWires.begin(), static_cast<int>(aOutputWires.size()));
+        }
+        void SetOutputWire( int aOutputIndex, int aWire ); // Primary output aOutputIndex follows wire aWire
+        void Finalize(); // Packs all wire fanout into one contiguous table (done automatically before simulating)
+
+        void ComputeOutput() override; // Drive the input wires and settle the changed gates
+        void ComputePacked( const cLogic::tPackedLevel* apInputs, cLogic::tPackedLevel* apOutputs ) override; // Evaluate 64 vectors gate by gate
+        bool Flatten( cNetlist& aNetlist, const int* apInputNets, int* apOutputNets ) const override; // Emit every gate in dataflow order
+        void ForEachChild( const std::function<void( cLogicGate& aChild, const std::string& aName )>& aVisit ) override; // Visits gate g as "g<g>"
+
+        int GetNumGates() const { return static_cast<int>(mGates.size()); }
+        int GetNumWires() const { return static_cast<int>(mWires.size()); }
+        cWire& GetWire( int aWire ) { return *mWires[aWire]; }
+        const cEventScheduler& GetScheduler() const { return mScheduler; }
+        const cNetlistArena& GetArena() const { return mArena; }
+        size_t GetNumConnections() const { return mFanoutTable.GetNumPins(); } // Gate inputs driven by wires, once finalized
+
+    private:
+        int Connect( cLogicGate* apGate, const int* apInputWires, int aNumInputWires, const int* apOutputWires, int aNumOutputWires ); // Wires up a gate the network already owns
+        const std::vector<int>& GetGateOrder() const; // Gates sorted so every driver precedes its loads
+
+        cNetlistArena mArena;            // Storage for the wires and arena-created gates, released last
+        std::vector<cWire*> mWires;      // All wires, primary inputs first
+        std::vector<cLogicGate*> mGates; // All gates, in the order they were added
+        std::vector<std::unique_ptr<cLogicGate>> mHeapGates; // Gates passed in through AddGate
+        std::vector<int> mPinStart;      // Gate g's wires are mPinWires[mPinStart[g] .. mPinStart[g+1])
+        std::vector<int> mPinWires;      // Input wires of each gate, then its output wires
+        std::vector<int> mWireDriver;    // Gate driving each wire (-1 for primary inputs and undriven wires)
+        std::vector<int> mOutputWires;   // Wire followed by each primary output (-1 if unset)
+        mutable std::vector<int> mGateOrder;               // Cached topological order, rebuilt after AddGate
+        std::vector<cLogic::tPackedLevel> mPackedWires;    // Scratch wire values for ComputePacked
+        cEventScheduler mScheduler;      // Event queue shared by every gate in the network
+        cFanoutTable mFanoutTable;       // Packed fanout of every wire
+        bool mFinalized;                 // mFanoutTable is up to date with the connections
+};
+
+#endif // GATE_NETWORK_HPP
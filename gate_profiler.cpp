@@ -0,0 +1,294 @@
+// File: gate_profiler.cpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Implementation file for the optional per-gate evaluation profiler.
+
+//--Includes-------------------------------------------------------------------
+#include "gate_profiler.hpp"
+
+#ifdef LOGICSIM_PROFILE
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
+
+//---Local state---------------------------------------------------------------
+namespace {
+
+std::mutex gMutex;                          // Guards gProfiles while gates register
+std::deque<cGateProfile> gProfiles;         // One record per gate ever evaluated; addresses are stable
+std::atomic<long long> gInputFanout(0);     // Fanout events with no gate evaluating (primary inputs)
+std::atomic<long long> gDepthHistogram[cGateProfiler::NumDepthBuckets];
+std::atomic<long long> gWaveHistogram[cGateProfiler::NumDepthBuckets];
+
+thread_local cGateProfile* gpCurrent = nullptr; // Gate this thread is evaluating, innermost first
+thread_local int gDepth = 0;                    // Evaluations currently nested on this thread
+thread_local int gMaxDepth = 0;                 // Deepest nesting since the outermost evaluation began
+
+int GetBucket( int aDepth ) {
+    int Bucket = 0;
+    while (aDepth > 1 && Bucket < cGateProfiler::NumDepthBuckets - 1) {
+        aDepth >>= 1;
+        ++Bucket;
+    }
+    return Bucket;
+}
+
+std::string GetTypeName( const std::type_info& aType ) {
+#if defined(__GNUG__)
+    int Status = 0;
+    char* pName = abi::__cxa_demangle(aType.name(), nullptr, nullptr, &Status);
+    if (Status == 0 && pName != nullptr) {
+        std::string Name(pName);
+        std::free(pName);
+        return Name;
+    }
+#endif
+    return aType.name();
+}
+
+// Counters summed over every gate of one type
+class cTypeTotals {
+    public:
+        int mGates = 0;
+        long long mEvaluations = 0;
+        long long mWastedEvaluations = 0;
+        long long mToggles = 0;
+        long long mFanoutEvents = 0;
+};
+
+std::map<std::string, cTypeTotals> GetTypeTotals() {
+    std::map<std::string, cTypeTotals> Totals;
+    std::map<const std::type_info*, std::string> Names;
+    for (const cGateProfile& Profile : gProfiles) {
+        auto Name = Names.find(Profile.mpType);
+        if (Name == Names.end())
+            Name = Names.emplace(Profile.mpType, GetTypeName(*Profile.mpType)).first;
+        cTypeTotals& Type = Totals[Name->second];
+        ++Type.mGates;
+        Type.mEvaluations += Profile.mEvaluations;
+        Type.mWastedEvaluations += Profile.mWastedEvaluations;
+        Type.mToggles += Profile.mToggles;
+        Type.mFanoutEvents += Profile.mFanoutEvents;
+    }
+    return Totals;
+}
+
+double Percent( long long aPart, long long aWhole ) {
+    return aWhole > 0 ? 100.0 * aPart / aWhole : 0.0;
+}
+
+void PrintHistogram( std::ostream& aOut, const char* apTitle, const std::atomic<long long>* apBuckets ) {
+    aOut << apTitle;
+    for (int b = 0; b < cGateProfiler::NumDepthBuckets; ++b) {
+        const long long Count = apBuckets[b].load(std::memory_order_relaxed);
+        if (Count == 0)
+            continue;
+        aOut << "  " << (1LL << b);
+        if (b > 0)
+            aOut << '-' << (2LL << b) - 1;
+        aOut << ':' << Count;
+    }
+    aOut << '\n';
+}
+
+void WriteHistogram( std::ostream& aOut, const std::atomic<long long>* apBuckets ) {
+    aOut << '[';
+    bool First = true;
+    for (int b = 0; b < cGateProfiler::NumDepthBuckets; ++b) {
+        const long long Count = apBuckets[b].load(std::memory_order_relaxed);
+        if (Count == 0)
+            continue;
+        aOut << (First ? "" : ",") << "{\"min\":" << (1LL << b) << ",\"max\":" << (2LL << b) - 1 << ",\"count\":" << Count << '}';
+        First = false;
+    }
+    aOut << ']';
+}
+
+// Writes the report when the program exits, if anything was profiled
+class cReportAtExit {
+    public:
+        ~cReportAtExit() {
+            if (gProfiles.empty())
+                return;
+            const char* pPath = std::getenv("LOGICSIM_PROFILE_JSON");
+            if (pPath != nullptr && *pPath != '\0') {
+                std::ofstream File(pPath);
+                cGateProfiler::WriteJson(File);
+                if (File)
+                    return;
+                std::cerr << "gate profiler: cannot write " << pPath << '\n';
+            }
+            cGateProfiler::PrintReport(std::cerr);
+        }
+};
+cReportAtExit gReportAtExit; // Declared after the state it reads, so destroyed before it
+
+} // namespace
+
+
+//---cGateProfiler Implementation----------------------------------------------
+cGateProfile* cGateProfiler::GetProfile( cLogicGate* apGate ) {
+    if (apGate->mpProfile != nullptr)
+        return apGate->mpProfile;
+
+    std::lock_guard<std::mutex> Lock(gMutex);
+    gProfiles.push_back(cGateProfile{ &typeid(*apGate), static_cast<int>(gProfiles.size()), 0, 0, 0, 0, 0 });
+    apGate->mpProfile = &gProfiles.back();
+    return apGate->mpProfile;
+}
+//---
+cGateProfiler::cScope::cScope( cLogicGate* apGate )
+    : mpProfile(GetProfile(apGate)), mpOuter(gpCurrent) {
+    ++mpProfile->mEvaluations;
+    mStartChanges = mpProfile->mOutputChanges;
+    gpCurrent = mpProfile;
+    if (++gDepth > gMaxDepth)
+        gMaxDepth = gDepth;
+}
+//---
+cGateProfiler::cScope::~cScope() {
+    if (mpProfile->mOutputChanges == mStartChanges)
+        ++mpProfile->mWastedEvaluations;
+    gpCurrent = mpOuter;
+
+    if (--gDepth == 0) {
+        // Outermost evaluation finished: record how deep the propagation it started went
+        gDepthHistogram[GetBucket(gMaxDepth)].fetch_add(1, std::memory_order_relaxed);
+        gMaxDepth = 0;
+    }
+}
+//---
+void cGateProfiler::OutputChanged( cLogicGate* apGate, cLogic::eLogicLevel aOldLevel, cLogic::eLogicLevel aNewLevel ) {
+    if (aOldLevel == aNewLevel || apGate->mpProfile == nullptr)
+        return; // Unchanged, or set outside any evaluation (a constructor settling its outputs)
+    ++apGate->mpProfile->mOutputChanges;
+    if (aOldLevel != cLogic::LOGIC_UNDEFINED && aNewLevel != cLogic::LOGIC_UNDEFINED)
+        ++apGate->mpProfile->mToggles;
+}
+//---
+void cGateProfiler::FanoutDriven( int aFanout ) {
+    if (gpCurrent != nullptr)
+        gpCurrent->mFanoutEvents += aFanout;
+    else
+        gInputFanout.fetch_add(aFanout, std::memory_order_relaxed);
+}
+//---
+void cGateProfiler::WavesRun( int aWaves ) {
+    if (aWaves > 0)
+        gWaveHistogram[GetBucket(aWaves)].fetch_add(1, std::memory_order_relaxed);
+}
+//---
+void cGateProfiler::PrintReport( std::ostream& aOut ) {
+    std::lock_guard<std::mutex> Lock(gMutex);
+    const std::map<std::string, cTypeTotals> Types = GetTypeTotals();
+
+    cTypeTotals All;
+    for (const auto& Type : Types) {
+        All.mGates += Type.second.mGates;
+        All.mEvaluations += Type.second.mEvaluations;
+        All.mWastedEvaluations += Type.second.mWastedEvaluations;
+        All.mToggles += Type.second.mToggles;
+        All.mFanoutEvents += Type.second.mFanoutEvents;
+    }
+
+    const std::ios_base::fmtflags Flags = aOut.flags();
+    const std::streamsize Precision = aOut.precision();
+    aOut.setf(std::ios_base::fixed);
+    aOut.precision(1);
+
+    aOut << "Gate profile: " << All.mGates << " gates, " << All.mEvaluations << " evaluations ("
+         << Percent(All.mWastedEvaluations, All.mEvaluations) << "% wasted), " << All.mToggles << " toggles, "
+         << All.mFanoutEvents << " fanout events (+" << gInputFanout.load() << " from primary inputs)\n";
+
+    aOut << "  " << std::left << std::setw(28) << "type" << std::right << std::setw(9) << "gates" << std::setw(13) << "evaluations"
+         << std::setw(9) << "wasted%" << std::setw(12) << "toggles" << std::setw(14) << "toggles/eval" << std::setw(12) << "fanout" << '\n';
+    for (const auto& Type : Types) {
+        const cTypeTotals& T = Type.second;
+        aOut << "  " << std::left << std::setw(28) << Type.first << std::right << std::setw(9) << T.mGates
+             << std::setw(13) << T.mEvaluations << std::setw(9) << Percent(T.mWastedEvaluations, T.mEvaluations)
+             << std::setw(12) << T.mToggles << std::setw(14) << std::setprecision(3)
+             << (T.mEvaluations > 0 ? double(T.mToggles) / T.mEvaluations : 0.0) << std::setprecision(1)
+             << std::setw(12) << T.mFanoutEvents << '\n';
+    }
+
+    // The gates doing the most evaluations that changed nothing
+    std::vector<const cGateProfile*> Wasteful;
+    for (const cGateProfile& Profile : gProfiles) {
+        if (Profile.mWastedEvaluations > 0)
+            Wasteful.push_back(&Profile);
+    }
+    const size_t NumShown = std::min<size_t>(Wasteful.size(), 10);
+    std::partial_sort(Wasteful.begin(), Wasteful.begin() + NumShown, Wasteful.end(),
+                      []( const cGateProfile* apA, const cGateProfile* apB ) { return apA->mWastedEvaluations > apB->mWastedEvaluations; });
+    if (NumShown > 0)
+        aOut << "  most wasted evaluations:\n";
+    for (size_t i = 0; i < NumShown; ++i) {
+        aOut << "    #" << Wasteful[i]->mId << ' ' << GetTypeName(*Wasteful[i]->mpType) << ": "
+             << Wasteful[i]->mWastedEvaluations << " of " << Wasteful[i]->mEvaluations << '\n';
+    }
+
+    PrintHistogram(aOut, "  evaluation depth:", gDepthHistogram);
+    PrintHistogram(aOut, "  scheduler waves: ", gWaveHistogram);
+
+    aOut.flags(Flags);
+    aOut.precision(Precision);
+}
+//---
+void cGateProfiler::WriteJson( std::ostream& aOut ) {
+    std::lock_guard<std::mutex> Lock(gMutex);
+
+    aOut << "{\"input_fanout_events\":" << gInputFanout.load() << ",\"depth_histogram\":";
+    WriteHistogram(aOut, gDepthHistogram);
+    aOut << ",\"wave_histogram\":";
+    WriteHistogram(aOut, gWaveHistogram);
+
+    aOut << ",\"types\":[";
+    bool First = true;
+    for (const auto& Type : GetTypeTotals()) {
+        const cTypeTotals& T = Type.second;
+        aOut << (First ? "" : ",") << "\n{\"type\":\"" << Type.first << "\",\"gates\":" << T.mGates
+             << ",\"evaluations\":" << T.mEvaluations << ",\"wasted_evaluations\":" << T.mWastedEvaluations
+             << ",\"toggles\":" << T.mToggles << ",\"fanout_events\":" << T.mFanoutEvents << '}';
+        First = false;
+    }
+
+    aOut << "],\"gates\":[";
+    std::map<const std::type_info*, std::string> Names;
+    for (const cGateProfile& Profile : gProfiles) {
+        auto Name = Names.find(Profile.mpType);
+        if (Name == Names.end())
+            Name = Names.emplace(Profile.mpType, GetTypeName(*Profile.mpType)).first;
+        aOut << (Profile.mId == 0 ? "" : ",") << "\n{\"id\":" << Profile.mId << ",\"type\":\"" << Name->second
+             << "\",\"evaluations\":" << Profile.mEvaluations << ",\"wasted_evaluations\":" << Profile.mWastedEvaluations
+             << ",\"output_changes\":" << Profile.mOutputChanges << ",\"toggles\":" << Profile.mToggles
+             << ",\"fanout_events\":" << Profile.mFanoutEvents << '}';
+    }
+    aOut << "]}\n";
+}
+//---
+void cGateProfiler::Reset() {
+    std::lock_guard<std::mutex> Lock(gMutex);
+
+    // Gates keep pointing at their records, so zero them rather than dropping them
+    for (cGateProfile& Profile : gProfiles)
+        Profile = cGateProfile{ Profile.mpType, Profile.mId, 0, 0, 0, 0, 0 };
+    gInputFanout = 0;
+    for (int b = 0; b < NumDepthBuckets; ++b) {
+        gDepthHistogram[b] = 0;
+        gWaveHistogram[b] = 0;
+    }
+}
+
+#endif // LOGICSIM_PROFILE
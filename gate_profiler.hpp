@@ -0,0 +1,86 @@
+// File: gate_profiler.hpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Header file for the optional per-gate evaluation profiler.
+
+#ifndef GATE_PROFILER_HPP
+#define GATE_PROFILER_HPP
+
+// The profiler is compiled in only when LOGICSIM_PROFILE is defined (make PROFILE=1).
+// Without it the hook macros below expand to nothing and cLogicGate carries no extra
+// member, so a normal build pays nothing for it.
+//
+// With it every gate evaluation is counted against the gate that ran it:
+//   - evaluations, and how many of them changed no output (wasted work)
+//   - output changes, and LOW<->HIGH toggles (switching activity)
+//   - fanout events: gate inputs driven by the gate's output wires
+// plus two histograms: the nesting depth reached by each top-level evaluation in the
+// recursive model, and the number of waves each cEventScheduler::Run needed.
+// A summary goes to stderr at exit, or JSON to the file named by $LOGICSIM_PROFILE_JSON.
+
+#ifdef LOGICSIM_PROFILE
+
+#include "logic_gates.hpp"
+#include <iosfwd>
+#include <typeinfo>
+
+// cGateProfile: Counters for one gate, kept by the profiler so they outlive the gate
+class cGateProfile {
+    public:
+        const std::type_info* mpType;   // Dynamic type of the gate
+        int mId;                        // Order in which the gate was first evaluated
+        long long mEvaluations;         // ComputeOutput or truth-table evaluations
+        long long mWastedEvaluations;   // Evaluations that left every output unchanged
+        long long mOutputChanges;       // Output value changes, including from UNDEFINED
+        long long mToggles;             // Output changes between LOW and HIGH
+        long long mFanoutEvents;        // Gate inputs driven by this gate's output wires
+};
+
+
+// cGateProfiler collects the counters. Counting is per thread: nesting state is thread-local
+// and each gate is only ever evaluated by one thread at a time.
+class cGateProfiler {
+    public:
+        static const int NumDepthBuckets = 32; // Histogram bucket b counts depths in [2^b, 2^(b+1))
+
+        // cScope: Brackets one evaluation of a gate
+        class cScope {
+            public:
+                explicit cScope( cLogicGate* apGate ); // Counts the evaluation and enters one nesting level
+                ~cScope(); // Decides whether the evaluation was wasted and leaves the level
+                cScope( const cScope& ) = delete;
+                cScope& operator=( const cScope& ) = delete;
+
+            private:
+                cGateProfile* mpProfile;    // Counters of the gate being evaluated
+                cGateProfile* mpOuter;      // Gate whose evaluation this one is nested in, if any
+                long long mStartChanges;    // mpProfile->mOutputChanges on entry
+        };
+
+        static void OutputChanged( cLogicGate* apGate, cLogic::eLogicLevel aOldLevel, cLogic::eLogicLevel aNewLevel );
+        static void FanoutDriven( int aFanout ); // Charged to the gate being evaluated, or to the primary inputs
+        static void WavesRun( int aWaves ); // Adds one cEventScheduler::Run to the wave histogram
+
+        static void PrintReport( std::ostream& aOut ); // Compact text summary
+        static void WriteJson( std::ostream& aOut );   // Every counter, including one record per gate
+        static void Reset(); // Forgets every gate and zeroes the histograms
+
+    private:
+        static cGateProfile* GetProfile( cLogicGate* apGate ); // Registers the gate on first use
+};
+
+#define LOGICSIM_PROFILE_EVALUATE( apGate ) cGateProfiler::cScope ProfileScope_( apGate )
+#define LOGICSIM_PROFILE_OUTPUT( apGate, aOld, aNew ) cGateProfiler::OutputChanged( apGate, aOld, aNew )
+#define LOGICSIM_PROFILE_FANOUT( aFanout ) cGateProfiler::FanoutDriven( aFanout )
+#define LOGICSIM_PROFILE_WAVES( aWaves ) cGateProfiler::WavesRun( aWaves )
+
+#else
+
+#define LOGICSIM_PROFILE_EVALUATE( apGate ) ((void)0)
+#define LOGICSIM_PROFILE_OUTPUT( apGate, aOld, aNew ) ((void)0)
+#define LOGICSIM_PROFILE_FANOUT( aFanout ) ((void)0)
+#define LOGICSIM_PROFILE_WAVES( aWaves ) ((void)0)
+
+#endif // LOGICSIM_PROFILE
+
+#endif // GATE_PROFILER_HPP
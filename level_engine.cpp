@@ -0,0 +1,106 @@
+// File: level_engine.cpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Implementation file for cLevelParallelEngine.
+
+//--Includes-------------------------------------------------------------------
+#include "level_engine.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+
+//---Local helpers-------------------------------------------------------------
+namespace {
+
+const int CacheLineBytes = 64;
+const int NetsPerLine = CacheLineBytes / sizeof(cLogic::tPackedLevel);
+
+} // namespace
+
+
+//---cLevelParallelEngine Implementation---------------------------------------
+cLevelParallelEngine::cLevelParallelEngine( const cNetlist& aNetlist, int aNumThreads, int aMinParallelGates )
+    : mNetlist(aNetlist),
+      mPool(aNumThreads),
+      mNumParallelLevels(0),
+      mArrived(0),
+      mPhase(0) {
+
+    mStorage.resize(mNetlist.GetNumNets() + NetsPerLine);
+    const std::uintptr_t Address = reinterpret_cast<std::uintptr_t>(mStorage.data());
+    mpNets = mStorage.data() + ((CacheLineBytes - Address % CacheLineBytes) % CacheLineBytes) / sizeof(cLogic::tPackedLevel);
+
+    Plan(aMinParallelGates);
+}
+//---
+void cLevelParallelEngine::Plan( int aMinParallelGates ) {
+    const int NumThreads = GetNumThreads();
+    const int NumInputs = mNetlist.GetNumInputs();
+
+    for (int Level = 0; Level < mNetlist.GetNumLevels(); ++Level) {
+        const int Begin = mNetlist.GetLevelBegin(Level), End = mNetlist.GetLevelEnd(Level);
+
+        if (NumThreads == 1 || End - Begin < aMinParallelGates) {
+            // Narrow: extend the open serial segment, or start one
+            if (!mSegments.empty() && mSegments.back().mFirstSplit < 0)
+                mSegments.back().mEndGate = End;
+            else
+                mSegments.push_back({ Begin, End, -1 });
+            continue;
+        }
+
+        // Wide: equal shares, each boundary rounded so its output net starts a cache line
+        mSegments.push_back({ Begin, End, static_cast<int>(mSplits.size()) });
+        mSplits.push_back(Begin);
+        for (int t = 1; t < NumThreads; ++t) {
+            int Split = Begin + static_cast<int>(static_cast<long long>(End - Begin) * t / NumThreads);
+            Split -= (NumInputs + Split) % NetsPerLine;
+            mSplits.push_back(std::max(Split, mSplits.back()));
+        }
+        mSplits.push_back(End);
+        ++mNumParallelLevels;
+    }
+}
+//---
+void cLevelParallelEngine::EvaluatePacked( const cLogic::tPackedLevel* apInputs, cLogic::tPackedLevel* apOutputs ) {
+    std::copy(apInputs, apInputs + mNetlist.GetNumInputs(), mpNets);
+
+    if (IsParallel())
+        mPool.Run([this]( int aThread ) { Work(aThread); });
+    else
+        mNetlist.EvaluateGates(mpNets, 0, mNetlist.GetNumGates()); // Below the threshold everywhere: plain serial loop
+
+    for (int o = 0; o < mNetlist.GetNumOutputs(); ++o)
+        apOutputs[o] = mpNets[mNetlist.GetOutput(o)];
+}
+//---
+void cLevelParallelEngine::Work( int aThread ) {
+    unsigned Phase = mPhase.load(std::memory_order_acquire);
+    for (const cSegment& Segment : mSegments) {
+        if (Segment.mFirstSplit < 0) {
+            if (aThread == 0)
+                mNetlist.EvaluateGates(mpNets, Segment.mFirstGate, Segment.mEndGate);
+        }
+        else
+            mNetlist.EvaluateGates(mpNets, mSplits[Segment.mFirstSplit + aThread], mSplits[Segment.mFirstSplit + aThread + 1]);
+        Barrier(Phase); // The next level reads what every thread just wrote
+    }
+}
+//---
+void cLevelParallelEngine::Barrier( unsigned& aPhase ) {
+    const int NumThreads = GetNumThreads();
+    const unsigned Next = aPhase + 1;
+
+    if (mArrived.fetch_add(1, std::memory_order_acq_rel) + 1 == NumThreads) {
+        mArrived.store(0, std::memory_order_relaxed);
+        mPhase.store(Next, std::memory_order_release); // Last arrival releases the others
+    }
+    else {
+        // Spin briefly, since levels are short, then give the core away
+        for (int Spins = 0; mPhase.load(std::memory_order_acquire) != Next; ++Spins) {
+            if (Spins > 256)
+                std::this_thread::yield();
+        }
+    }
+    aPhase = Next;
+}
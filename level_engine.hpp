@@ -0,0 +1,58 @@
+// File: level_engine.hpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Header file for cLevelParallelEngine, which evaluates one netlist level by level across threads.
+
+#ifndef LEVEL_ENGINE_HPP
+#define LEVEL_ENGINE_HPP
+
+#include "netlist.hpp"
+#include "thread_pool.hpp"
+#include <atomic>
+#include <vector>
+
+// cLevelParallelEngine evaluates a levelized cNetlist with every thread working on the same
+// stimulus. Gates within a level are independent, so each wide level is split into one
+// partition per thread, and the threads meet at a barrier before the next level.
+// Gate g writes net NumInputs+g, and the net array is cache-line aligned, so partitions
+// are cut on cache-line boundaries of the nets and threads never write the same line.
+// Runs of narrow levels are evaluated by the calling thread alone, and a netlist with
+// no wide level skips the pool entirely.
+class cLevelParallelEngine {
+    public:
+        static const int DefaultMinParallelGates = 2048; // Narrowest level worth splitting
+
+        explicit cLevelParallelEngine( const cNetlist& aNetlist, int aNumThreads = 0, int aMinParallelGates = DefaultMinParallelGates ); // aNetlist must outlive the engine
+        ~cLevelParallelEngine() {}
+
+        void EvaluatePacked( const cLogic::tPackedLevel* apInputs, cLogic::tPackedLevel* apOutputs ); // Same result as cNetlist::EvaluatePacked
+
+        int GetNumThreads() const { return mPool.GetNumThreads(); }
+        int GetNumParallelLevels() const { return mNumParallelLevels; } // Levels split across threads
+        bool IsParallel() const { return mNumParallelLevels > 0; }      // False: every evaluation is serial
+
+    private:
+        // cSegment: Consecutive gates evaluated between two barriers
+        class cSegment {
+            public:
+                int mFirstGate;  // First gate of the segment
+                int mEndGate;    // One past the last gate
+                int mFirstSplit; // Partition bounds in mSplits for a parallel segment, -1 for a serial one
+        };
+
+        void Plan( int aMinParallelGates ); // Builds mSegments and mSplits
+        void Work( int aThread ); // One thread's share of an evaluation
+        void Barrier( unsigned& aPhase ); // Waits for every thread
+
+        const cNetlist& mNetlist;                   // Netlist being evaluated
+        cThreadPool mPool;                          // Threads; the caller is thread 0
+        std::vector<cSegment> mSegments;            // Whole netlist, in level order
+        std::vector<int> mSplits;                   // NumThreads+1 partition bounds per parallel segment
+        int mNumParallelLevels;                     // See GetNumParallelLevels
+        std::vector<cLogic::tPackedLevel> mStorage; // Net values, over-allocated for alignment
+        cLogic::tPackedLevel* mpNets;               // Cache-line aligned start of the net values
+        alignas(64) std::atomic<int> mArrived;      // Threads at the barrier
+        alignas(64) std::atomic<unsigned> mPhase;   // Barrier generation
+};
+
+#endif // LEVEL_ENGINE_HPP
@@ -8,12 +8,21 @@
 #ifndef LOGICSIM_V1_HPP
 #define LOGICSIM_V1_HPP
 
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
 #include <iostream>
+#include <string>
 #include <vector>
 
 // Forward declarations for gate classes
 class cNandGate;
 class cLogicGate;
+class cNetlist;
+class cEventScheduler;
+class cTruthTable;
+class cGateProfile;
+class cTraceBinding;
 
 
 class cLogic {
@@ -25,24 +34,96 @@ class cLogic {
             LOGIC_LOW,            // Logic low (0)
             LOGIC_HIGH            // Logic high (1)
         };
+
+        // tPackedLevel: One two-valued signal across PackedWidth independent stimulus vectors.
+        // Bit n holds the level of the signal for vector n, so one bitwise op evaluates 64 vectors.
+        typedef std::uint64_t tPackedLevel;
+        static const int PackedWidth = 64; // Number of stimulus vectors carried by a tPackedLevel
+};
+
+
+// cFanoutPin: One gate input driven by a wire
+class cFanoutPin {
+    public:
+        cLogicGate* mpGate; // Gate being driven
+        int mInput;         // Which input of that gate
 };
 
 
 // cWire connects devices in the simulation
-// Each wire has a single input and may drive multiple outputs
+// Each wire has a single input and may drive any number of outputs. Connections are
+// collected per wire while a circuit is built; cFanoutTable then packs them into one
+// shared contiguous array so propagation walks sequential memory.
 class cWire {
     public:
         cWire(); // Constructor
         virtual ~cWire() {} // Destructor
+        cWire( const cWire& ) = delete;            // Wires are referenced by address
+        cWire& operator=( const cWire& ) = delete;
        
         void AddOutputConnection( cLogicGate* apGateToDrive, int aGateInputToDrive );  // Adds a connection from this wire to a gate input
-        void DriveLevel( cLogic::eLogicLevel aNewLevel ); // Drives the wire's value to all connected outputs
+        void DriveLevel( cLogic::eLogicLevel aNewLevel ); // Drives the wire's value to all connected outputs, if it changed
+        cLogic::eLogicLevel GetLevel() const { return mLevel; } // Level the wire is currently driven to
+        int GetFanout() const { return static_cast<int>(mpFanoutEnd - mpFanoutBegin); } // Number of gate inputs driven
+        const cFanoutPin* GetFanoutBegin() const { return mpFanoutBegin; }
+        const cFanoutPin* GetFanoutEnd() const { return mpFanoutEnd; }
         
     private:
-        static const int MaxFanout = 4;                // Maximum number of gates a wire can drive (fanout)
-        int mNumOutputConnections;            // Number of outputs currently connected
-        cLogicGate* mpGatesToDrive[MaxFanout]; // Array of pointers to gates driven by this wire
-        int mGateInputIndices[MaxFanout];     // Array of input indices for each driven gate
+        void BindFanout( const cFanoutPin* apBegin, const cFanoutPin* apEnd ); // Point at packed storage and drop the private list
+
+        cLogic::eLogicLevel mLevel;               // Current level, so unchanged drives stop here
+        std::vector<cFanoutPin> mPendingFanout;   // Connections added since the fanout was last packed
+        const cFanoutPin* mpFanoutBegin;          // First connection driven (pending list or packed table)
+        const cFanoutPin* mpFanoutEnd;            // One past the last connection driven
+
+        friend class cFanoutTable;
+};
+
+
+// cFanoutTable packs the fanout of many wires into compressed-sparse-row form:
+// one contiguous array of (gate, input) pairs plus an offset per wire.
+class cFanoutTable {
+    public:
+        cFanoutTable() {}
+        cFanoutTable( const cFanoutTable& ) = delete;            // Wires point into the storage
+        cFanoutTable& operator=( const cFanoutTable& ) = delete;
+
+        void Build( const std::vector<cWire*>& aWires ); // Packs every wire's connections and rebinds the wires to them
+        size_t GetNumPins() const { return mPins.size(); }
+
+    private:
+        std::vector<cFanoutPin> mPins;   // All connections, grouped by wire
+        std::vector<int> mOffsets;       // Wire w drives mPins[mOffsets[w] .. mOffsets[w+1])
+};
+
+
+// cPinArray: Fixed-size per-gate pin storage. Gates with up to tInline pins keep them
+// inside the gate object itself; larger gates fall back to one heap block.
+template<class T, int tInline>
+class cPinArray {
+    public:
+        cPinArray( int aSize, const T& aValue )
+            : mpData(aSize <= tInline ? mInline : new T[aSize]), mSize(aSize) {
+            for (int i = 0; i < aSize; ++i)
+                mpData[i] = aValue;
+        }
+        ~cPinArray() {
+            if (mpData != mInline)
+                delete[] mpData;
+        }
+        cPinArray( const cPinArray& ) = delete;            // mpData may point into the object
+        cPinArray& operator=( const cPinArray& ) = delete;
+
+        T& operator[]( int aIndex ) { return mpData[aIndex]; }
+        const T& operator[]( int aIndex ) const { return mpData[aIndex]; }
+        T* data() { return mpData; }
+        const T* data() const { return mpData; }
+        int size() const { return mSize; }
+
+    private:
+        T* mpData;          // mInline, or a heap block when there are more than tInline pins
+        int mSize;          // Number of pins
+        T mInline[tInline]; // Storage for small gates
 };
 
 
@@ -54,14 +135,46 @@ class cLogicGate {
 
         virtual void ConnectOutput( int aOutputIndex, cWire* apOutputConnection ); // Connects the output of this gate to a wire
         virtual void DriveInput( int aInputIndex, cLogic::eLogicLevel aNewLevel ); // Drives an input of this gate to a new logic level
+        void DriveInputs( const cLogic::eLogicLevel* apNewLevels, int aCount ); // Drives inputs 0..aCount-1 together and settles once
+        void DriveInputs( std::initializer_list<cLogic::eLogicLevel> aNewLevels ); // Drives inputs in order and settles once
+        void DriveInputBus( std::uint64_t aBus ); // Bit i drives input i HIGH or LOW (up to 64 inputs), settles once
         virtual cLogic::eLogicLevel GetOutputState(int aOutputIndex); // Gets the current output state of the gate
         virtual void TestOutputs() {}; // Print all output combinations 
         virtual void ComputeOutput() {}; // Computes the output value based on inputs
+        virtual void ComputePacked( const cLogic::tPackedLevel* apInputs, cLogic::tPackedLevel* apOutputs ); // Computes 64 vectors at once, one word per input/output
+        virtual bool Flatten( cNetlist& aNetlist, const int* apInputNets, int* apOutputNets ) const; // Emits this gate as primitives into a compiled netlist
+        virtual void ForEachChild( const std::function<void( cLogicGate& aChild, const std::string& aName )>& aVisit ); // Visits the component gates of a subcircuit, with a name for each
+
+        int GetNumInputs() const { return mInputs.size(); }        // Number of gate inputs
+        int GetNumOutputs() const { return mOutputValues.size(); } // Number of gate outputs
+
+        void SetScheduler( cEventScheduler* apScheduler ) { mpScheduler = apScheduler; } // Defer evaluation to an event queue (nullptr: evaluate immediately)
+        void SetDelay( int aDelay ) { mDelay = aDelay; } // Propagation delay of a primitive in timing simulation time units (0: default for its type)
+        int GetDelay() const { return mDelay; }
+        virtual bool IsTruthTableCandidate() const { return false; } // Whether the LUT cache may replace ComputeOutput
 
     protected:
-        std::vector<cLogic::eLogicLevel> mInputs;           // Input values for the gate
-        std::vector<cLogic::eLogicLevel> mOutputValues;     // Output values for the gate
-        std::vector<cWire*> mpOutputConnections;            // Output wire connections for each output
+        void SetOutput( int aOutputIndex, cLogic::eLogicLevel aNewLevel ); // Stores an output value and drives its wire
+        void Settle(); // Re-evaluates after an input change, now or through mpScheduler
+        void Evaluate(); // Computes the outputs, from a truth table when one is attached
+
+        cPinArray<cLogic::eLogicLevel, 3> mInputs;          // Input values for the gate
+        cPinArray<cLogic::eLogicLevel, 2> mOutputValues;    // Output values for the gate
+        cPinArray<cWire*, 2> mpOutputConnections;           // Output wire connections for each output
+        cEventScheduler* mpScheduler;                       // Event queue this gate is evaluated from, if any
+        bool mScheduled;                                    // Already waiting in mpScheduler's queue
+        const cTruthTable* mpTruthTable;                    // Cached truth table replacing ComputeOutput, if any
+        unsigned mTableGeneration;                          // Cache configuration mpTruthTable was chosen under
+        cTraceBinding* mpTrace;                             // Waveform tracer signals of this gate's pins, if traced
+        int mDelay;                                         // Propagation delay carried into compiled netlists, see SetDelay
+#ifdef LOGICSIM_PROFILE
+        cGateProfile* mpProfile = nullptr;                  // Profiler counters, created on first evaluation
+        friend class cGateProfiler;
+#endif
+
+        friend class cEventScheduler;
+        friend class cTruthTableCache;
+        friend class cWaveTracer;
 
         enum : int { INPUT_A, INPUT_B, INPUT_CARRY}; // Generic input indices
         enum : int { OUTPUT = 0, SUM_OUTPUT = 0, CARRY_OUTPUT}; // Generic output indices
@@ -76,6 +189,8 @@ class cAndGate : public cLogicGate {
 
         void TestOutputs() override; // Print all output combinations
         void ComputeOutput() override; // Compute outputs based on inputs
+        void ComputePacked( const cLogic::tPackedLevel* apInputs, cLogic::tPackedLevel* apOutputs ) override; // Bitwise kernel over 64 vectors
+        bool Flatten( cNetlist& aNetlist, const int* apInputNets, int* apOutputNets ) const override; // Emits a single primitive
         
 };
 
@@ -88,6 +203,8 @@ class cOrGate : public cLogicGate {
 
         void TestOutputs() override; // Print all output combinations
         void ComputeOutput() override; // Compute outputs based on inputs
+        void ComputePacked( const cLogic::tPackedLevel* apInputs, cLogic::tPackedLevel* apOutputs ) override; // Bitwise kernel over 64 vectors
+        bool Flatten( cNetlist& aNetlist, const int* apInputNets, int* apOutputNets ) const override; // Emits a single primitive
         
 };
 
@@ -100,6 +217,8 @@ class cXorGate : public cLogicGate {
 
         void TestOutputs() override; // Print all output combinations
         void ComputeOutput() override; // Compute outputs based on inputs
+        void ComputePacked( const cLogic::tPackedLevel* apInputs, cLogic::tPackedLevel* apOutputs ) override; // Bitwise kernel over 64 vectors
+        bool Flatten( cNetlist& aNetlist, const int* apInputNets, int* apOutputNets ) const override; // Emits a single primitive
         
 };
 
@@ -112,7 +231,105 @@ class cNandGate : public cLogicGate {
 
         void TestOutputs() override; // Print all output combinations
         void ComputeOutput() override; // Compute outputs based on inputs
+        void ComputePacked( const cLogic::tPackedLevel* apInputs, cLogic::tPackedLevel* apOutputs ) override; // Bitwise kernel over 64 vectors
+        bool Flatten( cNetlist& aNetlist, const int* apInputNets, int* apOutputNets ) const override; // Emits a single primitive
         
 };
 
+
+// NOR gate (inherits from cLogicGate)
+class cNorGate : public cLogicGate {
+    public:
+        cNorGate(); // Constructor
+        virtual ~cNorGate(); // Destructor
+
+        void TestOutputs() override; // Print all output combinations
+        void ComputeOutput() override; // Compute outputs based on inputs
+        void ComputePacked( const cLogic::tPackedLevel* apInputs, cLogic::tPackedLevel* apOutputs ) override; // Bitwise kernel over 64 vectors
+        bool Flatten( cNetlist& aNetlist, const int* apInputNets, int* apOutputNets ) const override; // Emits a single primitive
+        
+};
+
+
+// XNOR gate (inherits from cLogicGate)
+class cXnorGate : public cLogicGate {
+    public:
+        cXnorGate(); // Constructor
+        virtual ~cXnorGate(); // Destructor
+
+        void TestOutputs() override; // Print all output combinations
+        void ComputeOutput() override; // Compute outputs based on inputs
+        void ComputePacked( const cLogic::tPackedLevel* apInputs, cLogic::tPackedLevel* apOutputs ) override; // Bitwise kernel over 64 vectors
+        bool Flatten( cNetlist& aNetlist, const int* apInputNets, int* apOutputNets ) const override; // Emits a single primitive
+        
+};
+
+
+// NOT gate (inherits from cLogicGate)
+class cNotGate : public cLogicGate {
+    public:
+        cNotGate(); // Constructor
+        virtual ~cNotGate(); // Destructor
+
+        void TestOutputs() override; // Print all output combinations
+        void ComputeOutput() override; // Compute outputs based on inputs
+        void ComputePacked( const cLogic::tPackedLevel* apInputs, cLogic::tPackedLevel* apOutputs ) override; // Bitwise kernel over 64 vectors
+        bool Flatten( cNetlist& aNetlist, const int* apInputNets, int* apOutputNets ) const override; // Emits a single primitive
+        
+};
+
+
+// Buffer gate (inherits from cLogicGate)
+class cBufGate : public cLogicGate {
+    public:
+        cBufGate(); // Constructor
+        virtual ~cBufGate(); // Destructor
+
+        void TestOutputs() override; // Print all output combinations
+        void ComputeOutput() override; // Compute outputs based on inputs
+        void ComputePacked( const cLogic::tPackedLevel* apInputs, cLogic::tPackedLevel* apOutputs ) override; // Bitwise kernel over 64 vectors
+        bool Flatten( cNetlist& aNetlist, const int* apInputNets, int* apOutputNets ) const override; // Emits a single primitive
+        
+};
+
+
+// Constant (tie-off) gate (inherits from cLogicGate)
+class cConstantGate : public cLogicGate {
+    public:
+        explicit cConstantGate(cLogic::eLogicLevel aLevel); // Constructor
+        virtual ~cConstantGate(); // Destructor
+
+        void TestOutputs() override; // Print all output combinations
+        void ComputeOutput() override; // Compute outputs based on inputs
+        void ComputePacked( const cLogic::tPackedLevel* apInputs, cLogic::tPackedLevel* apOutputs ) override; // Bitwise kernel over 64 vectors
+        bool Flatten( cNetlist& aNetlist, const int* apInputNets, int* apOutputNets ) const override; // Emits a single constant
+
+    private:
+        cLogic::eLogicLevel mLevel; // Level driven on the output at all times
+};
+
+
+// D flip-flop with enable and synchronous reset (inherits from cLogicGate)
+// The only clocked element: Q changes on a rising CLK edge and holds otherwise. On the edge,
+// RESET HIGH loads the reset level, else ENABLE HIGH loads D, else Q holds. Enable starts HIGH
+// and reset LOW, so a plain D flip-flop only needs D and CLK connected. For whole clocked
+// designs, cSequentialCircuit (cycle_sim.hpp) simulates cycles without events.
+class cDFlipFlop : public cLogicGate {
+    public:
+        enum : int { INPUT_D, INPUT_CLK, INPUT_ENABLE, INPUT_RESET }; // Input indices
+
+        explicit cDFlipFlop(cLogic::eLogicLevel aResetLevel = cLogic::LOGIC_LOW); // Constructor, Q starts undefined
+        virtual ~cDFlipFlop(); // Destructor
+
+        void ComputeOutput() override; // Samples on a rising clock edge
+        void ComputePacked( const cLogic::tPackedLevel* apInputs, cLogic::tPackedLevel* apOutputs ) override; // Held Q in every vector; packed words have no edges
+
+        cLogic::eLogicLevel GetResetLevel() const { return mResetLevel; }
+
+    private:
+        cLogic::eLogicLevel mResetLevel; // Level RESET loads into Q
+        cLogic::eLogicLevel mLastClock;  // CLK at the previous evaluation, for edge detection
+        cLogic::eLogicLevel mState;      // Stored Q
+};
+
 #endif // LOGICSIM_V1_HPP
\ No newline at end of file
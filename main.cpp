@@ -1,16 +1,178 @@
 // File: main.cpp
 // Author: Dylan George
-// Date Modified: 1st September 2025
+// Date Modified: 16th October 2026
 // Description: Main entry point for the logic circuit simulator program.
+//              With no arguments the demo simulation runs. With --batch a circuit is
+//              simulated over stimulus vectors streamed from a file or stdin:
+//                A4 --batch CIRCUIT [--in FILE] [--out FILE] [--format text|binary]
+//                   [--in-format text|binary] [--out-format text|binary] [--optimize] [--faults] [--stats]
+//              CIRCUIT is a built-in name (see --list) or a .bench/.blif netlist; --optimize
+//              runs the AIG optimization pass over it first. --faults grades the stimulus
+//              against every stuck-at fault and writes a coverage report instead of responses.
 
 #include "logic_gates.hpp" // Include logic gate definitions
 #include "circuits.hpp"    // Include circuit definitions
+#include "batch_sim.hpp"   // Streaming stimulus/response mode
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <memory>
+#include <unistd.h>
 
-int main() {
+namespace {
+
+void PrintUsage() {
+    std::cerr << "usage: A4\n"
+              << "       A4 --batch CIRCUIT [--in FILE] [--out FILE] [--format text|binary]\n"
+              << "          [--in-format text|binary] [--out-format text|binary] [--optimize] [--faults] [--stats]\n"
+              << "       A4 --list\n";
+}
+
+bool ParseFormat( const char* apText, cBatchSimulator::eFormat& aFormat ) {
+    if (std::strcmp(apText, "text") == 0)
+        aFormat = cBatchSimulator::FORMAT_TEXT;
+    else if (std::strcmp(apText, "binary") == 0)
+        aFormat = cBatchSimulator::FORMAT_BINARY;
+    else
+        return false;
+    return true;
+}
+
+// Coverage report for --faults: totals, then every fault the stimulus missed
+std::string FormatFaultReport( const cFaultSimulator& aFaults ) {
+    char Coverage[32];
+    std::snprintf(Coverage, sizeof(Coverage), "%.2f", 100.0 * aFaults.GetCoverage());
+    std::string Report = "faults " + std::to_string(aFaults.GetNumFaults()) + "\n"
+                       + "detected " + std::to_string(aFaults.GetNumDetected()) + "\n"
+                       + "coverage " + Coverage + "%\n"
+                       + "vectors " + std::to_string(aFaults.GetNumVectors()) + "\n";
+    for (const cFaultSimulator::cFault& Fault : aFaults.GetFaults()) {
+        if (Fault.mDetectedBy < 0)
+            Report += "undetected " + aFaults.Describe(Fault) + "\n";
+    }
+    return Report;
+}
+
+// Runs --batch; returns the process exit code
+int RunBatch( int argc, char** argv ) {
+    const char* pCircuit = nullptr;
+    const char* pInPath = nullptr;
+    const char* pOutPath = nullptr;
+    cBatchSimulator::eFormat InFormat = cBatchSimulator::FORMAT_TEXT;
+    cBatchSimulator::eFormat OutFormat = cBatchSimulator::FORMAT_TEXT;
+    bool Optimize = false;
+    bool Faults = false;
+    bool Stats = false;
+
+    for (int a = 1; a < argc; ++a) {
+        const bool HasValue = a + 1 < argc;
+        if (std::strcmp(argv[a], "--batch") == 0 && HasValue)
+            pCircuit = argv[++a];
+        else if (std::strcmp(argv[a], "--in") == 0 && HasValue)
+            pInPath = argv[++a];
+        else if (std::strcmp(argv[a], "--out") == 0 && HasValue)
+            pOutPath = argv[++a];
+        else if (std::strcmp(argv[a], "--format") == 0 && HasValue && ParseFormat(argv[a + 1], InFormat)) {
+            OutFormat = InFormat;
+            ++a;
+        }
+        else if (std::strcmp(argv[a], "--in-format") == 0 && HasValue && ParseFormat(argv[a + 1], InFormat))
+            ++a;
+        else if (std::strcmp(argv[a], "--out-format") == 0 && HasValue && ParseFormat(argv[a + 1], OutFormat))
+            ++a;
+        else if (std::strcmp(argv[a], "--optimize") == 0)
+            Optimize = true;
+        else if (std::strcmp(argv[a], "--faults") == 0)
+            Faults = true;
+        else if (std::strcmp(argv[a], "--stats") == 0)
+            Stats = true;
+        else {
+            PrintUsage();
+            return 2;
+        }
+    }
+    if (pCircuit == nullptr) {
+        PrintUsage();
+        return 2;
+    }
+
+    cBatchSimulator Batch;
+    if (!Batch.SetCircuit(pCircuit)) {
+        std::cerr << "A4: " << Batch.GetError() << '\n';
+        return 1;
+    }
+    if (Optimize && !Batch.Optimize()) {
+        std::cerr << "A4: " << Batch.GetError() << '\n';
+        return 1;
+    }
+    if (Optimize && Stats) {
+        const cNetlistOptimizer::cReport& Report = Batch.GetOptimizeReport();
+        std::cerr << "A4: optimized " << Report.mGatesBefore << " -> " << Report.mGatesAfter << " gates, "
+                  << Report.mLevelsBefore << " -> " << Report.mLevelsAfter << " levels\n";
+    }
+
+    const int InFile = pInPath != nullptr ? open(pInPath, O_RDONLY) : STDIN_FILENO;
+    if (InFile < 0) {
+        std::cerr << "A4: cannot open " << pInPath << ": " << std::strerror(errno) << '\n';
+        return 1;
+    }
+    const int OutFile = pOutPath != nullptr ? open(pOutPath, O_WRONLY | O_CREAT | O_TRUNC, 0644) : STDOUT_FILENO;
+    if (OutFile < 0) {
+        std::cerr << "A4: cannot create " << pOutPath << ": " << std::strerror(errno) << '\n';
+        return 1;
+    }
+
+    const std::chrono::steady_clock::time_point Start = std::chrono::steady_clock::now();
+    std::unique_ptr<cFaultSimulator> pFaults(Faults ? new cFaultSimulator(Batch.GetNetlist()) : nullptr);
+    bool Ok = Faults ? Batch.Grade(InFile, InFormat, *pFaults) : Batch.Run(InFile, OutFile, InFormat, OutFormat);
+    const double Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - Start).count();
+
+    if (Faults && Ok) {
+        const std::string Report = FormatFaultReport(*pFaults);
+        for (size_t Done = 0; Done < Report.size() && Ok; ) {
+            const ssize_t Written = write(OutFile, Report.data() + Done, Report.size() - Done);
+            Ok = Written > 0 || (Written < 0 && errno == EINTR);
+            Done += Written > 0 ? static_cast<size_t>(Written) : 0;
+        }
+        if (!Ok)
+            std::cerr << "A4: cannot write fault report: " << std::strerror(errno) << '\n';
+    }
+
+    if (pInPath != nullptr)
+        close(InFile);
+    if (pOutPath != nullptr && close(OutFile) != 0 && Ok) {
+        std::cerr << "A4: cannot write " << pOutPath << ": " << std::strerror(errno) << '\n';
+        return 1;
+    }
+    if (!Ok && !Batch.GetError().empty())
+        std::cerr << "A4: " << Batch.GetError() << '\n';
+    if (Stats && Faults) {
+        std::cerr << "A4: graded " << pFaults->GetNumVectors() << " vectors against " << pFaults->GetNumFaults() << " faults in "
+                  << Seconds << " s (" << pFaults->GetNumWords() << " fault words)\n";
+    }
+    else if (Stats) {
+        std::cerr << "A4: " << Batch.GetNumVectors() << " vectors through " << Batch.GetNetlist().GetNumGates()
+                  << " gates in " << Seconds << " s (" << (Seconds > 0 ? Batch.GetNumVectors() / Seconds : 0.0) << " vectors/s)\n";
+    }
+    return Ok ? 0 : 1;
+}
+
+} // namespace
+
+int main( int argc, char** argv ) {
+
+    if (argc > 1 && std::strcmp(argv[1], "--list") == 0) {
+        std::cout << cBatchSimulator::GetCircuitNames() << '\n';
+        return 0;
+    }
+    if (argc > 1)
+        return RunBatch(argc, argv);
 
     cSimulation* sim = new cSimulation();
     sim->RunSimulation();
     delete sim;
-    
+
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,54 @@
+// File: mapped_file.cpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Implementation file for cMappedFile (POSIX mmap).
+
+//--Includes-------------------------------------------------------------------
+#include "mapped_file.hpp"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+//---cMappedFile Implementation------------------------------------------------
+cMappedFile::cMappedFile() : mpData(nullptr), mSize(0) {}
+//---
+cMappedFile::~cMappedFile() {
+    Close();
+}
+//---
+bool cMappedFile::Open( const char* apPath ) {
+    Close();
+
+    const int File = open(apPath, O_RDONLY);
+    if (File < 0)
+        return false;
+
+    struct stat Info;
+    if (fstat(File, &Info) != 0) {
+        close(File);
+        return false;
+    }
+
+    mSize = static_cast<size_t>(Info.st_size);
+    if (mSize > 0) {
+        void* pMapping = mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, File, 0);
+        if (pMapping == MAP_FAILED) {
+            close(File);
+            mSize = 0;
+            return false;
+        }
+        madvise(pMapping, mSize, MADV_SEQUENTIAL); // Parsers and images are read front to back
+        mpData = static_cast<const char*>(pMapping);
+    }
+
+    close(File); // The mapping keeps its own reference to the file
+    return true;
+}
+//---
+void cMappedFile::Close() {
+    if (mpData != nullptr)
+        munmap(const_cast<char*>(mpData), mSize);
+    mpData = nullptr;
+    mSize = 0;
+}
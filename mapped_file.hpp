@@ -0,0 +1,32 @@
+// File: mapped_file.hpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Header file for cMappedFile, a read-only memory-mapped file.
+
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#include <cstddef>
+
+// cMappedFile maps a whole file read-only into memory, so large netlists are read
+// straight from the page cache without copying them into a buffer first.
+// The mapping stays valid until Close or destruction.
+class cMappedFile {
+    public:
+        cMappedFile(); // Constructor, nothing mapped
+        ~cMappedFile(); // Unmaps the file
+        cMappedFile( const cMappedFile& ) = delete;            // Owns the mapping
+        cMappedFile& operator=( const cMappedFile& ) = delete;
+
+        bool Open( const char* apPath ); // Maps apPath, replacing any previous mapping; false if it cannot be read
+        void Close(); // Unmaps the file
+
+        const char* GetData() const { return mpData; } // First byte of the file (nullptr when empty or closed)
+        size_t GetSize() const { return mSize; }       // File length in bytes
+
+    private:
+        const char* mpData; // Start of the mapping
+        size_t mSize;       // Length of the mapping
+};
+
+#endif // MAPPED_FILE_HPP
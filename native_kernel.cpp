@@ -0,0 +1,407 @@
+// File: native_kernel.cpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Implementation file for cNativeKernel and cNativeCircuit (POSIX fork/exec and dlopen).
+
+//--Includes-------------------------------------------------------------------
+#include "native_kernel.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <fstream>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+//---Local helpers-------------------------------------------------------------
+namespace {
+
+const char* const FormatTag = "logicsim-kernel-1"; // Bump when GenerateSource changes what it emits
+const char* const CompilerFlags[] = { "-O2", "-fPIC", "-shared" };
+
+// FNV-1a, 64-bit
+class cHasher {
+    public:
+        cHasher() : mHash(0xCBF29CE484222325ull) {}
+
+        void Add( const void* apData, std::size_t aSize ) {
+            const unsigned char* pByte = static_cast<const unsigned char*>(apData);
+            for (std::size_t i = 0; i < aSize; ++i)
+                mHash = (mHash ^ pByte[i]) * 0x100000001B3ull;
+        }
+        void Add( int aValue ) { Add(&aValue, sizeof(aValue)); }
+        void Add( const std::string& aText ) { Add(aText.data(), aText.size() + 1); } // With the terminator, so "ab" + "c" != "a" + "bc"
+
+        std::uint64_t Get() const { return mHash; }
+
+    private:
+        std::uint64_t mHash; // Running hash
+};
+
+std::string GetEnv( const char* apName ) {
+    const char* pValue = std::getenv(apName);
+    return pValue != nullptr ? pValue : "";
+}
+
+// mkdir -p
+bool MakeDirs( const std::string& aPath ) {
+    for (std::size_t Slash = aPath.find('/', 1); ; Slash = aPath.find('/', Slash + 1)) {
+        const std::string Prefix = aPath.substr(0, Slash);
+        if (mkdir(Prefix.c_str(), 0755) != 0 && errno != EEXIST)
+            return false;
+        if (Slash == std::string::npos)
+            return true;
+    }
+}
+
+// Creates aPath with mode 0700 if missing, then checks it is a real directory owned by this
+// user that nobody else can write to or plant files in
+bool MakePrivateDir( const std::string& aPath ) {
+    if (mkdir(aPath.c_str(), 0700) != 0 && errno != EEXIST)
+        return false;
+    struct stat Info;
+    if (lstat(aPath.c_str(), &Info) != 0)
+        return false;
+    if (!S_ISDIR(Info.st_mode) || Info.st_uid != geteuid() || (Info.st_mode & 077) != 0) {
+        errno = EPERM;
+        return false;
+    }
+    return true;
+}
+
+// Up to aLimit bytes of a text file, for compiler diagnostics
+std::string ReadText( const std::string& aPath, std::size_t aLimit ) {
+    std::ifstream File(aPath);
+    std::string Text(aLimit, '\0');
+    File.read(&Text[0], aLimit);
+    Text.resize(static_cast<std::size_t>(File.gcount()));
+    return Text;
+}
+
+} // namespace
+
+//---cNativeKernel Implementation----------------------------------------------
+cNativeKernel::cNativeKernel()
+    : mPrivateCacheDir(false), mpLibrary(nullptr), mpEvaluate(nullptr), mpEvaluateBlocks(nullptr), mWasCached(false) {
+
+    mCacheDir = GetEnv("LOGICSIM_KERNEL_CACHE");
+    if (mCacheDir.empty()) {
+        const std::string XdgCache = GetEnv("XDG_CACHE_HOME");
+        const std::string Home = GetEnv("HOME");
+        if (!XdgCache.empty())
+            mCacheDir = XdgCache + "/logicsim-kernels";
+        else if (!Home.empty())
+            mCacheDir = Home + "/.cache/logicsim-kernels";
+        else {
+            mCacheDir = "/tmp/logicsim-kernels-" + std::to_string(geteuid());
+            mPrivateCacheDir = true; // /tmp is shared, so the directory must be ours alone
+        }
+    }
+
+    mCompiler = GetEnv("CXX");
+    if (mCompiler.empty())
+        mCompiler = "g++";
+}
+//---
+cNativeKernel::~cNativeKernel() {
+    Unload();
+}
+//---
+void cNativeKernel::Unload() {
+    if (mpLibrary != nullptr)
+        dlclose(mpLibrary);
+    mpLibrary = nullptr;
+    mpEvaluate = nullptr;
+    mpEvaluateBlocks = nullptr;
+    mPath.clear();
+}
+//---
+bool cNativeKernel::Fail( const std::string& aError ) {
+    Unload();
+    mError = aError;
+    return false;
+}
+//---
+std::uint64_t cNativeKernel::GetHash( const cNetlist& aNetlist ) const {
+    cHasher Hasher;
+    Hasher.Add(std::string(FormatTag));
+    Hasher.Add(mCompiler);
+    for (const char* pFlag : CompilerFlags)
+        Hasher.Add(std::string(pFlag));
+
+    Hasher.Add(aNetlist.GetNumInputs());
+    Hasher.Add(aNetlist.GetNumOutputs());
+    Hasher.Add(aNetlist.GetNumGates());
+    for (int g = 0; g < aNetlist.GetNumGates(); ++g) {
+        Hasher.Add(static_cast<int>(aNetlist.GetOpcode(g)));
+        Hasher.Add(aNetlist.GetInputA(g));
+        Hasher.Add(aNetlist.GetInputB(g));
+        Hasher.Add(aNetlist.GetOutputNet(g));
+    }
+    for (int o = 0; o < aNetlist.GetNumOutputs(); ++o)
+        Hasher.Add(aNetlist.GetOutput(o));
+    return Hasher.Get();
+}
+//---
+bool cNativeKernel::GenerateSource( const cNetlist& aNetlist, std::uint64_t aHash, std::string& aSource ) {
+    const int NumInputs = aNetlist.GetNumInputs();
+    const int NumOutputs = aNetlist.GetNumOutputs();
+
+    // Every net must be assigned before it is read, which Levelize guarantees
+    std::vector<char> Defined(aNetlist.GetNumNets(), 0);
+    std::fill(Defined.begin(), Defined.begin() + NumInputs, 1);
+
+    char Line[128];
+    aSource.clear();
+    aSource.reserve(64 + 40 * static_cast<std::size_t>(aNetlist.GetNumGates()));
+    std::snprintf(Line, sizeof(Line), "// Generated by logicsim: %d inputs, %d gates, %d outputs\n",
+                  NumInputs, aNetlist.GetNumGates(), NumOutputs);
+    aSource += Line;
+    aSource += "#include <cstddef>\n"
+               "#include <cstdint>\n"
+               "typedef std::uint64_t w;\n"
+               "static inline void Evaluate(const w* in, w* out) {\n";
+
+    for (int i = 0; i < NumInputs; ++i) {
+        std::snprintf(Line, sizeof(Line), "const w n%d = in[%d];\n", i, i);
+        aSource += Line;
+    }
+
+    for (int g = 0; g < aNetlist.GetNumGates(); ++g) {
+        const int A = aNetlist.GetInputA(g);
+        const int B = aNetlist.GetInputB(g);
+        const int Out = aNetlist.GetOutputNet(g);
+        const int NumReads = cNetlist::GetOpcodeInputs(aNetlist.GetOpcode(g));
+        if ((NumReads > 0 && !Defined[A]) || (NumReads > 1 && !Defined[B]) || Defined[Out])
+            return false;
+        Defined[Out] = 1;
+
+        switch (aNetlist.GetOpcode(g)) {
+            case cNetlist::OP_AND:    std::snprintf(Line, sizeof(Line), "const w n%d = n%d & n%d;\n", Out, A, B); break;
+            case cNetlist::OP_OR:     std::snprintf(Line, sizeof(Line), "const w n%d = n%d | n%d;\n", Out, A, B); break;
+            case cNetlist::OP_XOR:    std::snprintf(Line, sizeof(Line), "const w n%d = n%d ^ n%d;\n", Out, A, B); break;
+            case cNetlist::OP_NAND:   std::snprintf(Line, sizeof(Line), "const w n%d = ~(n%d & n%d);\n", Out, A, B); break;
+            case cNetlist::OP_NOR:    std::snprintf(Line, sizeof(Line), "const w n%d = ~(n%d | n%d);\n", Out, A, B); break;
+            case cNetlist::OP_XNOR:   std::snprintf(Line, sizeof(Line), "const w n%d = ~(n%d ^ n%d);\n", Out, A, B); break;
+            case cNetlist::OP_NOT:    std::snprintf(Line, sizeof(Line), "const w n%d = ~n%d;\n", Out, A); break;
+            case cNetlist::OP_BUF:    std::snprintf(Line, sizeof(Line), "const w n%d = n%d;\n", Out, A); break;
+            case cNetlist::OP_CONST0: std::snprintf(Line, sizeof(Line), "const w n%d = 0;\n", Out); break;
+            case cNetlist::OP_CONST1: std::snprintf(Line, sizeof(Line), "const w n%d = ~w(0);\n", Out); break;
+        }
+        aSource += Line;
+    }
+
+    for (int o = 0; o < NumOutputs; ++o) {
+        if (!Defined[aNetlist.GetOutput(o)])
+            return false;
+        std::snprintf(Line, sizeof(Line), "out[%d] = n%d;\n", o, aNetlist.GetOutput(o));
+        aSource += Line;
+    }
+    aSource += "}\n";
+
+    // The exported hash lets Load reject an object left over from a different netlist
+    std::snprintf(Line, sizeof(Line), "0x%016" PRIx64 "ull", aHash);
+    aSource += "extern \"C\" {\n"
+               "extern const unsigned long long logicsim_kernel_hash;\n"
+               "const unsigned long long logicsim_kernel_hash = ";
+    aSource += Line;
+    aSource += ";\n"
+               "void logicsim_evaluate(const w* in, w* out) { Evaluate(in, out); }\n"
+               "void logicsim_evaluate_blocks(const w* in, w* out, std::size_t blocks) {\n";
+    std::snprintf(Line, sizeof(Line), "for (std::size_t b = 0; b < blocks; ++b) Evaluate(in + b * %d, out + b * %d);\n", NumInputs, NumOutputs);
+    aSource += Line;
+    aSource += "}\n"
+               "}\n";
+    return true;
+}
+//---
+bool cNativeKernel::Load( const std::string& aPath, std::uint64_t aHash ) {
+    Unload();
+    mpLibrary = dlopen(aPath.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if (mpLibrary == nullptr) {
+        mError = dlerror();
+        return false;
+    }
+
+    const unsigned long long* pHash = static_cast<const unsigned long long*>(dlsym(mpLibrary, "logicsim_kernel_hash"));
+    mpEvaluate = reinterpret_cast<tEvaluate>(dlsym(mpLibrary, "logicsim_evaluate"));
+    mpEvaluateBlocks = reinterpret_cast<tEvaluateBlocks>(dlsym(mpLibrary, "logicsim_evaluate_blocks"));
+    if (pHash == nullptr || *pHash != aHash || mpEvaluate == nullptr || mpEvaluateBlocks == nullptr) {
+        Unload();
+        mError = "built for a different netlist";
+        return false;
+    }
+    mPath = aPath;
+    return true;
+}
+//---
+bool cNativeKernel::Compile( const std::string& aSourcePath, const std::string& aObjectPath, const std::string& aLogPath ) {
+    std::vector<const char*> Args;
+    Args.push_back(mCompiler.c_str());
+    for (const char* pFlag : CompilerFlags)
+        Args.push_back(pFlag);
+    Args.push_back("-o");
+    Args.push_back(aObjectPath.c_str());
+    Args.push_back(aSourcePath.c_str());
+    Args.push_back(nullptr);
+
+    const pid_t Child = fork();
+    if (Child < 0)
+        return Fail(std::string("fork failed: ") + std::strerror(errno));
+
+    if (Child == 0) {
+        // Compiler diagnostics go to the log rather than our own stdout/stderr
+        const int Log = open(aLogPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (Log >= 0) {
+            dup2(Log, STDOUT_FILENO);
+            dup2(Log, STDERR_FILENO);
+            close(Log);
+        }
+        execvp(Args[0], const_cast<char* const*>(Args.data()));
+        _exit(127);
+    }
+
+    int Status = 0;
+    while (waitpid(Child, &Status, 0) < 0) {
+        if (errno != EINTR)
+            return Fail(std::string("waitpid failed: ") + std::strerror(errno));
+    }
+    if (WIFEXITED(Status) && WEXITSTATUS(Status) == 0)
+        return true;
+    if (WIFEXITED(Status) && WEXITSTATUS(Status) == 127)
+        return Fail("could not run compiler '" + mCompiler + "'");
+    return Fail("compiler '" + mCompiler + "' failed: " + ReadText(aLogPath, 512));
+}
+//---
+bool cNativeKernel::Build( const cNetlist& aNetlist ) {
+    Unload();
+    mError.clear();
+    mWasCached = false;
+
+    const std::uint64_t Hash = GetHash(aNetlist);
+    char Name[32];
+    std::snprintf(Name, sizeof(Name), "%016" PRIx64, Hash);
+    const std::string Base = mCacheDir + "/" + Name;
+    const std::string ObjectPath = Base + ".so";
+
+    // Never load from a shared directory another user could have planted an object in
+    if (mPrivateCacheDir && !MakePrivateDir(mCacheDir))
+        return Fail("kernel cache " + mCacheDir + " is not a private directory: " + std::strerror(errno));
+
+    if (Load(ObjectPath, Hash)) {
+        mWasCached = true;
+        return true;
+    }
+    mError.clear(); // Usually just not cached yet
+
+    std::string Source;
+    if (!GenerateSource(aNetlist, Hash, Source))
+        return Fail("netlist is not levelized");
+    if (!MakeDirs(mCacheDir))
+        return Fail("cannot create kernel cache " + mCacheDir + ": " + std::strerror(errno));
+
+    // Build under names private to this process, then rename into place, so concurrent builds
+    // of the same netlist never load a half-written object
+    const std::string Unique = Base + "." + std::to_string(getpid());
+    const std::string SourcePath = Unique + ".cpp";
+    const std::string TempPath = Unique + ".so";
+    const std::string LogPath = Unique + ".log";
+    {
+        std::ofstream File(SourcePath, std::ios::binary);
+        if (!File.write(Source.data(), static_cast<std::streamsize>(Source.size())))
+            return Fail("cannot write " + SourcePath);
+    }
+
+    const bool Compiled = Compile(SourcePath, TempPath, LogPath);
+    std::remove(LogPath.c_str());
+    if (!Compiled) {
+        std::remove(SourcePath.c_str());
+        std::remove(TempPath.c_str());
+        return false;
+    }
+    std::rename(SourcePath.c_str(), (Base + ".cpp").c_str()); // Kept beside the object for inspection
+    if (std::rename(TempPath.c_str(), ObjectPath.c_str()) != 0) {
+        std::remove(TempPath.c_str());
+        return Fail("cannot install " + ObjectPath + ": " + std::strerror(errno));
+    }
+
+    if (!Load(ObjectPath, Hash))
+        return Fail("cannot load " + ObjectPath + ": " + mError);
+    return true;
+}
+
+//---cNativeCircuit Implementation---------------------------------------------
+cNativeCircuit::cNativeCircuit( const cLogicGate& aSource )
+    : cLogicGate(aSource.GetNumInputs(), aSource.GetNumOutputs()),
+      mCompiled(false),
+      mOutputLevels(aSource.GetNumOutputs(), cLogic::LOGIC_UNDEFINED),
+      mPackedInputs(aSource.GetNumInputs()),
+      mPackedOutputs(aSource.GetNumOutputs()) {
+
+    mCompiled = mNetlist.Compile(aSource);
+    if (mCompiled)
+        mKernel.Build(mNetlist);
+}
+//---
+std::string cNativeCircuit::GetError() const {
+    return mCompiled ? mKernel.GetError() : "circuit could not be flattened";
+}
+//---
+void cNativeCircuit::ComputeOutput() {
+    if (!mCompiled) {
+        for (int o = 0; o < GetNumOutputs(); ++o)
+            SetOutput(o, cLogic::LOGIC_UNDEFINED);
+        return;
+    }
+
+    bool Defined = mKernel.IsLoaded(); // Without a kernel the netlist does all the work
+    for (int i = 0; i < GetNumInputs(); ++i) {
+        Defined = Defined && mInputs[i] != cLogic::LOGIC_UNDEFINED;
+        mPackedInputs[i] = mInputs[i] == cLogic::LOGIC_HIGH ? 1 : 0;
+    }
+
+    if (Defined) {
+        mKernel.Evaluate(mPackedInputs.data(), mPackedOutputs.data());
+        for (int o = 0; o < GetNumOutputs(); ++o)
+            mOutputLevels[o] = (mPackedOutputs[o] & 1) ? cLogic::LOGIC_HIGH : cLogic::LOGIC_LOW;
+    }
+    else {
+        mNetlist.Evaluate(mInputs.data(), mOutputLevels.data(), mNets);
+    }
+
+    for (int o = 0; o < GetNumOutputs(); ++o)
+        SetOutput(o, mOutputLevels[o]); // Store and drive output wire
+}
+//---
+void cNativeCircuit::ComputePacked( const cLogic::tPackedLevel* apInputs, cLogic::tPackedLevel* apOutputs ) {
+    if (mKernel.IsLoaded())
+        mKernel.Evaluate(apInputs, apOutputs);
+    else if (mCompiled)
+        mNetlist.EvaluatePacked(apInputs, apOutputs, mPackedNets);
+    else
+        std::fill(apOutputs, apOutputs + GetNumOutputs(), cLogic::tPackedLevel(0));
+}
+//---
+bool cNativeCircuit::Flatten( cNetlist& aNetlist, const int* apInputNets, int* apOutputNets ) const {
+    if (!mCompiled)
+        return false;
+
+    // Copy the compiled gates, mapping their nets into the enclosing netlist
+    std::vector<int> NetMap(mNetlist.GetNumNets());
+    std::copy(apInputNets, apInputNets + mNetlist.GetNumInputs(), NetMap.begin());
+
+    for (int g = 0; g < mNetlist.GetNumGates(); ++g) {
+        const int A = mNetlist.GetInputA(g);
+        const int B = mNetlist.GetInputB(g);
+        NetMap[mNetlist.GetOutputNet(g)] = aNetlist.AddGate(mNetlist.GetOpcode(g), A >= 0 ? NetMap[A] : -1, B >= 0 ? NetMap[B] : -1, mNetlist.GetDelay(g));
+    }
+
+    for (int o = 0; o < mNetlist.GetNumOutputs(); ++o)
+        apOutputNets[o] = NetMap[mNetlist.GetOutput(o)];
+    return true;
+}
@@ -0,0 +1,103 @@
+// File: native_kernel.hpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Header file for cNativeKernel, which compiles a netlist to machine code through
+//              the system C++ compiler, and cNativeCircuit, a gate evaluated by such a kernel.
+
+#ifndef NATIVE_KERNEL_HPP
+#define NATIVE_KERNEL_HPP
+
+#include "logic_gates.hpp"
+#include "netlist.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// cNativeKernel turns a levelized netlist into straight-line C++ (one 64-bit word operation per
+// gate, every net a local the compiler can keep in a register), builds it as a shared object
+// with the local compiler and loads it with dlopen. Objects are cached on disk under a hash of
+// the netlist and the compiler command, so a circuit is only compiled the first time it is seen;
+// later builds of the same netlist, in this process or any other, just load the cached object.
+//
+// The cache directory is $LOGICSIM_KERNEL_CACHE, else $XDG_CACHE_HOME/logicsim-kernels, else
+// ~/.cache/logicsim-kernels, else /tmp/logicsim-kernels-<uid>. That last one is in a directory
+// every user shares, so it is created with mode 0700 and Build refuses to use it unless it is
+// owned by this user and closed to everyone else. The compiler is $CXX, else g++.
+class cNativeKernel {
+    public:
+        typedef void (*tEvaluate)( const cLogic::tPackedLevel* apInputs, cLogic::tPackedLevel* apOutputs );
+        typedef void (*tEvaluateBlocks)( const cLogic::tPackedLevel* apInputs, cLogic::tPackedLevel* apOutputs, std::size_t aNumBlocks );
+
+        cNativeKernel(); // Constructor, nothing loaded; cache directory and compiler from the environment
+        ~cNativeKernel(); // Unloads the kernel
+        cNativeKernel( const cNativeKernel& ) = delete;            // Owns the loaded object
+        cNativeKernel& operator=( const cNativeKernel& ) = delete;
+
+        void SetCacheDir( const std::string& aDir ) { mCacheDir = aDir; mPrivateCacheDir = false; } // Where objects are kept (created on demand)
+        void SetCompiler( const std::string& aCompiler ) { mCompiler = aCompiler; } // Compiler executable, found on PATH
+
+        bool Build( const cNetlist& aNetlist ); // Loads the cached kernel for aNetlist, compiling it first if needed; false on failure (see GetError)
+        void Unload(); // Releases the loaded kernel
+
+        bool IsLoaded() const { return mpEvaluate != nullptr; }
+        bool WasCached() const { return mWasCached; } // The last Build found the object on disk and did not run the compiler
+        const std::string& GetError() const { return mError; } // Why the last Build failed
+        const std::string& GetPath() const { return mPath; }   // Shared object of the loaded kernel
+
+        // Kernel entry points; the kernel must be loaded. One word per input and output, as cNetlist::EvaluatePacked
+        void Evaluate( const cLogic::tPackedLevel* apInputs, cLogic::tPackedLevel* apOutputs ) const { mpEvaluate(apInputs, apOutputs); }
+        // aNumBlocks independent 64-vector blocks: block b reads apInputs[b * inputs...] and writes apOutputs[b * outputs...]
+        void EvaluateBlocks( const cLogic::tPackedLevel* apInputs, cLogic::tPackedLevel* apOutputs, std::size_t aNumBlocks ) const { mpEvaluateBlocks(apInputs, apOutputs, aNumBlocks); }
+
+        static bool GenerateSource( const cNetlist& aNetlist, std::uint64_t aHash, std::string& aSource ); // The C++ Build compiles; false if gates are out of order
+        std::uint64_t GetHash( const cNetlist& aNetlist ) const; // Cache key: netlist structure, compiler and flags
+
+    private:
+        bool Fail( const std::string& aError ); // Records aError, unloads and returns false
+        bool Load( const std::string& aPath, std::uint64_t aHash ); // dlopens aPath and checks it was built for aHash
+        bool Compile( const std::string& aSourcePath, const std::string& aObjectPath, const std::string& aLogPath ); // Runs the compiler
+
+        std::string mCacheDir;              // See SetCacheDir
+        bool mPrivateCacheDir;              // mCacheDir is the /tmp fallback and must pass the ownership check
+        std::string mCompiler;              // See SetCompiler
+        void* mpLibrary;                    // dlopen handle of the loaded kernel
+        tEvaluate mpEvaluate;               // Entry point for one block
+        tEvaluateBlocks mpEvaluateBlocks;   // Entry point for many blocks
+        bool mWasCached;                    // See WasCached
+        std::string mError;                 // See GetError
+        std::string mPath;                  // See GetPath
+};
+
+
+// cNativeCircuit: Wraps any circuit as a natively compiled kernel. Scalar evaluation packs the
+// inputs into one lane; an undefined input falls back to the interpreted netlist so floating
+// wires still propagate as in cCompiledCircuit. When the kernel cannot be built (no compiler,
+// a failed compile, an unwritable cache) the interpreted netlist evaluates everything, and a
+// source that cannot be flattened gives undefined outputs (0 in packed words).
+class cNativeCircuit : public cLogicGate {
+    public:
+        explicit cNativeCircuit( const cLogicGate& aSource ); // Compiles aSource to a netlist, then to a native kernel
+        virtual ~cNativeCircuit() {}
+
+        void ComputeOutput() override; // Evaluate the kernel for the current inputs
+        void ComputePacked( const cLogic::tPackedLevel* apInputs, cLogic::tPackedLevel* apOutputs ) override; // Evaluate 64 vectors
+        bool Flatten( cNetlist& aNetlist, const int* apInputNets, int* apOutputNets ) const override; // Inline the compiled gates
+
+        bool IsValid() const { return mKernel.IsLoaded(); } // False if the source could not be flattened or the kernel not built
+        std::string GetError() const; // Why IsValid is false
+        const cNetlist& GetNetlist() const { return mNetlist; }
+        const cNativeKernel& GetKernel() const { return mKernel; }
+
+    private:
+        cNetlist mNetlist;                                   // Flattened form of the source circuit
+        cNativeKernel mKernel;                               // mNetlist compiled to machine code
+        bool mCompiled;                                      // The source flattened into mNetlist
+        std::vector<cLogic::eLogicLevel> mNets;              // Scratch net values for the undefined-input fallback
+        std::vector<cLogic::eLogicLevel> mOutputLevels;      // Scratch output values for scalar evaluation
+        std::vector<cLogic::tPackedLevel> mPackedInputs;     // One-lane inputs for scalar evaluation
+        std::vector<cLogic::tPackedLevel> mPackedOutputs;    // One-lane outputs for scalar evaluation
+        std::vector<cLogic::tPackedLevel> mPackedNets;       // Scratch net values for packed evaluation without a kernel
+};
+
+#endif // NATIVE_KERNEL_HPP
@@ -0,0 +1,564 @@
+// File: netlist.cpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Implementation file for the compiled netlist and cCompiledCircuit.
+
+//--Includes-------------------------------------------------------------------
+#include "netlist.hpp"
+#include "dual_rail.hpp"
+#include "mapped_file.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+
+//---Local helpers-------------------------------------------------------------
+namespace {
+
+// Three-valued evaluation of one primitive, matching the gate classes:
+// any UNDEFINED input gives an UNDEFINED output.
+cLogic::eLogicLevel EvaluateLevel( cNetlist::eOpcode aOpcode, cLogic::eLogicLevel aA, cLogic::eLogicLevel aB ) {
+
+  const int NumInputs = cNetlist::GetOpcodeInputs(aOpcode);
+  if( (NumInputs > 0 && aA == cLogic::LOGIC_UNDEFINED) || (NumInputs > 1 && aB == cLogic::LOGIC_UNDEFINED) )
+    return cLogic::LOGIC_UNDEFINED;
+
+  const bool A = (aA == cLogic::LOGIC_HIGH);
+  const bool B = (aB == cLogic::LOGIC_HIGH);
+  bool Out = false;
+  switch( aOpcode ) {
+    case cNetlist::OP_AND:    Out = A && B;    break;
+    case cNetlist::OP_OR:     Out = A || B;    break;
+    case cNetlist::OP_XOR:    Out = A != B;    break;
+    case cNetlist::OP_NAND:   Out = !(A && B); break;
+    case cNetlist::OP_NOR:    Out = !(A || B); break;
+    case cNetlist::OP_XNOR:   Out = A == B;    break;
+    case cNetlist::OP_NOT:    Out = !A;        break;
+    case cNetlist::OP_BUF:    Out = A;         break;
+    case cNetlist::OP_CONST0: Out = false;     break;
+    case cNetlist::OP_CONST1: Out = true;      break;
+  }
+  return Out ? cLogic::LOGIC_HIGH : cLogic::LOGIC_LOW;
+}
+
+// Layout of a binary netlist image: this header, then InputA, InputB and OutputNet
+// (NumGates int32 each), Outputs (NumOutputs int32), LevelStart (NumLevels+1 int32)
+// and finally Opcodes (NumGates bytes). Values are in host byte order.
+class cImageHeader {
+  public:
+    char mMagic[8];             // ImageMagic
+    std::uint32_t mVersion;     // ImageVersion
+    std::uint32_t mByteOrder;   // ImageByteOrder as written by the producing host
+    std::uint32_t mNumInputs;
+    std::uint32_t mNumNets;
+    std::uint32_t mNumGates;
+    std::uint32_t mNumOutputs;
+    std::uint32_t mNumLevels;
+    std::uint32_t mSourceNanoseconds; // cImageStamp of the source, all zero when there is none
+    std::uint64_t mSourceSize;
+    std::int64_t mSourceSeconds;
+};
+
+const char ImageMagic[8] = { 'L', 'S', 'N', 'E', 'T', 'I', 'M', 'G' };
+const std::uint32_t ImageVersion = 2;
+const std::uint32_t ImageByteOrder = 0x01020304;
+
+// Total image size for the given shape
+size_t ImageSize( const cImageHeader& aHeader ) {
+  return sizeof(cImageHeader)
+       + sizeof(std::int32_t) * (3 * size_t(aHeader.mNumGates) + aHeader.mNumOutputs + aHeader.mNumLevels + 1)
+       + aHeader.mNumGates;
+}
+
+} // namespace
+
+
+//---cNetlist Implementation---------------------------------------------------
+cNetlist::cNetlist() : mNumInputs(0), mNumNets(0) {
+  mLevelStart.push_back(0); // No levels yet
+  BindArrays();
+}
+//---
+cNetlist::cNetlist( const cNetlist& aOther ) {
+  *this = aOther;
+}
+//---
+cNetlist& cNetlist::operator=( const cNetlist& aOther ) {
+
+  if( this == &aOther )
+    return *this;
+
+  mNumInputs = aOther.mNumInputs;
+  mNumNets = aOther.mNumNets;
+  mNumGates = aOther.mNumGates;
+  mNumOutputs = aOther.mNumOutputs;
+  mNumLevels = aOther.mNumLevels;
+  mInputNets = aOther.mInputNets;
+  mOpcodes = aOther.mOpcodes;
+  mInputA = aOther.mInputA;
+  mInputB = aOther.mInputB;
+  mOutputNet = aOther.mOutputNet;
+  mDelays = aOther.mDelays;
+  mOutputs = aOther.mOutputs;
+  mLevelStart = aOther.mLevelStart;
+  mpImage = aOther.mpImage;
+
+  if( mpImage ) {
+    // Both netlists read the same read-only mapping
+    mpOpcodes = aOther.mpOpcodes;
+    mpInputA = aOther.mpInputA;
+    mpInputB = aOther.mpInputB;
+    mpOutputNet = aOther.mpOutputNet;
+    mpOutputs = aOther.mpOutputs;
+    mpLevelStart = aOther.mpLevelStart;
+  }
+  else
+    BindArrays();
+  return *this;
+}
+//---
+void cNetlist::BindArrays() {
+
+  mpOpcodes = mOpcodes.data();
+  mpInputA = mInputA.data();
+  mpInputB = mInputB.data();
+  mpOutputNet = mOutputNet.data();
+  mpOutputs = mOutputs.data();
+  mpLevelStart = mLevelStart.data();
+  mNumGates = static_cast<int>(mOpcodes.size());
+  mNumOutputs = static_cast<int>(mOutputs.size());
+  mNumLevels = static_cast<int>(mLevelStart.size()) - 1;
+}
+//---
+void cNetlist::Unmap() {
+
+  if( !mpImage )
+    return;
+
+  mInputNets.resize(mNumInputs);
+  for( int i=0; i<mNumInputs; ++i )
+    mInputNets[i] = i;
+  mOpcodes.assign(mpOpcodes, mpOpcodes + mNumGates);
+  mInputA.assign(mpInputA, mpInputA + mNumGates);
+  mInputB.assign(mpInputB, mpInputB + mNumGates);
+  mOutputNet.assign(mpOutputNet, mpOutputNet + mNumGates);
+  mDelays.assign(mNumGates, 0);
+  mOutputs.assign(mpOutputs, mpOutputs + mNumOutputs);
+  mLevelStart.assign(mpLevelStart, mpLevelStart + mNumLevels + 1);
+  mpImage.reset();
+  BindArrays();
+}
+//---
+void cNetlist::Clear() {
+
+  mNumInputs = 0;
+  mNumNets = 0;
+  mInputNets.clear();
+  mOpcodes.clear();
+  mInputA.clear();
+  mInputB.clear();
+  mOutputNet.clear();
+  mDelays.clear();
+  mOutputs.clear();
+  mLevelStart.assign(1, 0);
+  mpImage.reset();
+  BindArrays();
+}
+//---
+int cNetlist::GetOpcodeInputs( eOpcode aOpcode ) {
+
+  switch( aOpcode ) {
+    case OP_NOT:
+    case OP_BUF:    return 1;
+    case OP_CONST0:
+    case OP_CONST1: return 0;
+    default:        return 2;
+  }
+}
+//---
+bool cNetlist::Compile( const cLogicGate& aCircuit ) {
+
+  Clear();
+
+  std::vector<int> InputNets(aCircuit.GetNumInputs());
+  std::vector<int> OutputNets(aCircuit.GetNumOutputs(), -1);
+  for( int& Net : InputNets )
+    Net = AddInput();
+
+  if( !aCircuit.Flatten(*this, InputNets.data(), OutputNets.data()) ) {
+    Clear();
+    return false;
+  }
+
+  for( int Net : OutputNets )
+    AddOutput(Net);
+
+  return Levelize();
+}
+//---
+int cNetlist::AddInput() {
+
+  Unmap();
+  mInputNets.push_back(mNumNets);
+  ++mNumInputs;
+  return mNumNets++;
+}
+//---
+int cNetlist::AddGate( eOpcode aOpcode, int aInputA, int aInputB, int aDelay ) {
+
+  Unmap();
+  const int OutputNet = mNumNets++;
+  mOpcodes.push_back(aOpcode);
+  mInputA.push_back(aInputA);
+  mInputB.push_back(aInputB);
+  mOutputNet.push_back(OutputNet);
+  mDelays.push_back(static_cast<std::uint16_t>(std::min(std::max(aDelay, 0), 0xFFFF)));
+  BindArrays();
+  return OutputNet;
+}
+//---
+void cNetlist::AddOutput( int aNet ) {
+
+  Unmap();
+  mOutputs.push_back(aNet);
+  BindArrays();
+}
+//---
+bool cNetlist::Levelize() {
+
+  if( mpImage )
+    return true; // Images are only ever written levelized
+
+  const int NumGates = GetNumGates();
+  const int NumNets = GetNumNets();
+
+  // Level of each net: primary inputs are level 0, a gate is one more than its deepest input.
+  // Gates may have been added in any order, so resolve them with a worklist (Kahn's algorithm).
+  std::vector<int> Driver(NumNets, -1);
+  for( int g=0; g<NumGates; ++g )
+    Driver[mOutputNet[g]] = g;
+
+  std::vector<int> Pending(NumGates, 0);       // Inputs of each gate not yet levelled
+  std::vector<int> FanoutStart(NumNets + 1, 0); // CSR fanout of each net, to release waiting gates
+  for( int g=0; g<NumGates; ++g ) {
+    for( int Net : { mInputA[g], mInputB[g] } ) {
+      if( Net >= 0 && Driver[Net] >= 0 ) {
+        ++Pending[g];
+        ++FanoutStart[Net + 1];
+      }
+    }
+  }
+  for( int n=0; n<NumNets; ++n )
+    FanoutStart[n + 1] += FanoutStart[n];
+
+  std::vector<int> Fanout(FanoutStart[NumNets]);
+  std::vector<int> Fill(FanoutStart.begin(), FanoutStart.end() - 1);
+  for( int g=0; g<NumGates; ++g ) {
+    for( int Net : { mInputA[g], mInputB[g] } ) {
+      if( Net >= 0 && Driver[Net] >= 0 )
+        Fanout[Fill[Net]++] = g;
+    }
+  }
+
+  std::vector<int> NetLevel(NumNets, 0);
+  std::vector<int> Ready;
+  Ready.reserve(NumGates);
+  for( int g=0; g<NumGates; ++g ) {
+    if( Pending[g] == 0 )
+      Ready.push_back(g);
+  }
+  for( size_t r=0; r<Ready.size(); ++r ) {
+    const int g = Ready[r];
+    int Level = 0;
+    for( int Net : { mInputA[g], mInputB[g] } ) {
+      if( Net >= 0 )
+        Level = std::max(Level, NetLevel[Net]);
+    }
+    NetLevel[mOutputNet[g]] = Level + 1;
+
+    for( int f=FanoutStart[mOutputNet[g]]; f<FanoutStart[mOutputNet[g] + 1]; ++f ) {
+      if( --Pending[Fanout[f]] == 0 )
+        Ready.push_back(Fanout[f]);
+    }
+  }
+  if( static_cast<int>(Ready.size()) != NumGates )
+    return false; // Some gates depend on themselves
+
+  // Stable counting sort of gates by level
+  int Depth = 0;
+  for( int g=0; g<NumGates; ++g )
+    Depth = std::max(Depth, NetLevel[mOutputNet[g]]);
+
+  mLevelStart.assign(Depth + 1, 0);
+  for( int g=0; g<NumGates; ++g )
+    ++mLevelStart[NetLevel[mOutputNet[g]]];  // Level L (1-based) counted in slot L
+  for( int l=0; l<Depth; ++l )
+    mLevelStart[l + 1] += mLevelStart[l];    // Slot L now holds the end of level L
+
+  std::vector<int> Order(NumGates);
+  std::vector<int> Next(mLevelStart.begin(), mLevelStart.end() - 1); // Start of each level
+  for( int g=0; g<NumGates; ++g )
+    Order[Next[NetLevel[mOutputNet[g]] - 1]++] = g;
+
+  // Renumber nets so inputs come first and the gate at position p drives net NumInputs+p
+  std::vector<int> NewNet(NumNets, -1);
+  for( int i=0; i<mNumInputs; ++i )
+    NewNet[mInputNets[i]] = i;
+  for( int p=0; p<NumGates; ++p )
+    NewNet[mOutputNet[Order[p]]] = mNumInputs + p;
+
+  std::vector<std::uint8_t> Opcodes(NumGates);
+  std::vector<std::int32_t> InputA(NumGates), InputB(NumGates), OutputNet(NumGates);
+  std::vector<std::uint16_t> Delays(NumGates);
+  for( int p=0; p<NumGates; ++p ) {
+    const int g = Order[p];
+    Opcodes[p] = mOpcodes[g];
+    Delays[p] = mDelays[g];
+    InputA[p] = mInputA[g] >= 0 ? NewNet[mInputA[g]] : -1;
+    InputB[p] = mInputB[g] >= 0 ? NewNet[mInputB[g]] : -1;
+    OutputNet[p] = mNumInputs + p;
+  }
+  mOpcodes.swap(Opcodes);
+  mInputA.swap(InputA);
+  mInputB.swap(InputB);
+  mOutputNet.swap(OutputNet);
+  mDelays.swap(Delays);
+  for( std::int32_t& Net : mOutputs )
+    Net = NewNet[Net];
+  for( int i=0; i<mNumInputs; ++i )
+    mInputNets[i] = i;
+
+  BindArrays();
+  return true;
+}
+//---
+bool cNetlist::WriteImage( const char* apPath, const cImageStamp& aStamp ) const {
+
+  if( mpLevelStart[mNumLevels] != mNumGates )
+    return false; // Gates were added since the last Levelize
+
+  cImageHeader Header;
+  std::memcpy(Header.mMagic, ImageMagic, sizeof(ImageMagic));
+  Header.mVersion = ImageVersion;
+  Header.mByteOrder = ImageByteOrder;
+  Header.mNumInputs = mNumInputs;
+  Header.mNumNets = mNumNets;
+  Header.mNumGates = mNumGates;
+  Header.mNumOutputs = mNumOutputs;
+  Header.mNumLevels = mNumLevels;
+  Header.mSourceNanoseconds = aStamp.mNanoseconds;
+  Header.mSourceSize = aStamp.mSize;
+  Header.mSourceSeconds = aStamp.mSeconds;
+
+  // Write under a name private to this process, then rename into place: a netlist already
+  // mapping the old image keeps its inode, and readers never see a half-written file
+  const std::string TempPath = std::string(apPath) + "." + std::to_string(getpid());
+  std::ofstream File(TempPath, std::ios::binary | std::ios::trunc);
+  File.write(reinterpret_cast<const char*>(&Header), sizeof(Header));
+  File.write(reinterpret_cast<const char*>(mpInputA), sizeof(std::int32_t) * mNumGates);
+  File.write(reinterpret_cast<const char*>(mpInputB), sizeof(std::int32_t) * mNumGates);
+  File.write(reinterpret_cast<const char*>(mpOutputNet), sizeof(std::int32_t) * mNumGates);
+  File.write(reinterpret_cast<const char*>(mpOutputs), sizeof(std::int32_t) * mNumOutputs);
+  File.write(reinterpret_cast<const char*>(mpLevelStart), sizeof(std::int32_t) * (mNumLevels + 1));
+  File.write(reinterpret_cast<const char*>(mpOpcodes), mNumGates);
+  File.close();
+
+  if( !File || std::rename(TempPath.c_str(), apPath) != 0 ) {
+    std::remove(TempPath.c_str());
+    return false;
+  }
+  return true;
+}
+//---
+bool cNetlist::MapImage( const char* apPath, const cImageStamp* apStamp ) {
+
+  std::shared_ptr<cMappedFile> pFile = std::make_shared<cMappedFile>();
+  if( !pFile->Open(apPath) || pFile->GetSize() < sizeof(cImageHeader) )
+    return false;
+
+  cImageHeader Header;
+  std::memcpy(&Header, pFile->GetData(), sizeof(Header));
+  if( std::memcmp(Header.mMagic, ImageMagic, sizeof(ImageMagic)) != 0 || Header.mVersion != ImageVersion
+      || Header.mByteOrder != ImageByteOrder || pFile->GetSize() != ImageSize(Header)
+      || Header.mNumNets != Header.mNumInputs + Header.mNumGates || Header.mNumNets > 0x7FFFFFFFu )
+    return false;
+  if( apStamp != nullptr && (Header.mSourceSize != apStamp->mSize || Header.mSourceSeconds != apStamp->mSeconds
+                             || Header.mSourceNanoseconds != apStamp->mNanoseconds) )
+    return false; // Built from a different version of the source
+
+  const std::int32_t* pWords = reinterpret_cast<const std::int32_t*>(pFile->GetData() + sizeof(Header));
+  const std::int32_t* pInputA = pWords;
+  const std::int32_t* pInputB = pInputA + Header.mNumGates;
+  const std::int32_t* pOutputNet = pInputB + Header.mNumGates;
+  const std::int32_t* pOutputs = pOutputNet + Header.mNumGates;
+  const std::int32_t* pLevelStart = pOutputs + Header.mNumOutputs;
+  const std::uint8_t* pOpcodes = reinterpret_cast<const std::uint8_t*>(pLevelStart + Header.mNumLevels + 1);
+
+  // Check every index once, so evaluation can trust the image without bounds checks
+  const int NumInputs = static_cast<int>(Header.mNumInputs);
+  const int NumGates = static_cast<int>(Header.mNumGates);
+  const int NumNets = static_cast<int>(Header.mNumNets);
+  if( pLevelStart[0] != 0 || pLevelStart[Header.mNumLevels] != NumGates )
+    return false;
+  for( std::uint32_t l=0; l<Header.mNumLevels; ++l ) {
+    if( pLevelStart[l + 1] < pLevelStart[l] )
+      return false;
+  }
+  for( int g=0; g<NumGates; ++g ) {
+    if( pOpcodes[g] > OP_CONST1 || pOutputNet[g] != NumInputs + g )
+      return false;
+    for( std::int32_t Net : { pInputA[g], pInputB[g] } ) {
+      if( Net < -1 || Net >= NumInputs + g )
+        return false; // Out of range, or not driven by an earlier gate
+    }
+  }
+  for( std::uint32_t o=0; o<Header.mNumOutputs; ++o ) {
+    if( pOutputs[o] < 0 || pOutputs[o] >= NumNets )
+      return false;
+  }
+
+  Clear();
+  mNumInputs = NumInputs;
+  mNumNets = NumNets;
+  mNumGates = NumGates;
+  mNumOutputs = static_cast<int>(Header.mNumOutputs);
+  mNumLevels = static_cast<int>(Header.mNumLevels);
+  mpOpcodes = pOpcodes;
+  mpInputA = pInputA;
+  mpInputB = pInputB;
+  mpOutputNet = pOutputNet;
+  mpOutputs = pOutputs;
+  mpLevelStart = pLevelStart;
+  mpImage = pFile;
+  return true;
+}
+//---
+void cNetlist::Evaluate( const cLogic::eLogicLevel* apInputs, cLogic::eLogicLevel* apOutputs, std::vector<cLogic::eLogicLevel>& aNets ) const {
+
+  aNets.resize(GetNumNets());
+  std::copy(apInputs, apInputs + mNumInputs, aNets.begin());
+
+  for( int g=0; g<GetNumGates(); ++g ) {
+    const cLogic::eLogicLevel A = mpInputA[g] >= 0 ? aNets[mpInputA[g]] : cLogic::LOGIC_UNDEFINED;
+    const cLogic::eLogicLevel B = mpInputB[g] >= 0 ? aNets[mpInputB[g]] : cLogic::LOGIC_UNDEFINED;
+    aNets[mpOutputNet[g]] = EvaluateLevel(GetOpcode(g), A, B);
+  }
+
+  for( int o=0; o<GetNumOutputs(); ++o )
+    apOutputs[o] = aNets[mpOutputs[o]];
+}
+//---
+void cNetlist::EvaluatePacked( const cLogic::tPackedLevel* apInputs, cLogic::tPackedLevel* apOutputs, std::vector<cLogic::tPackedLevel>& aNets ) const {
+
+  aNets.resize(GetNumNets());
+  std::copy(apInputs, apInputs + mNumInputs, aNets.begin());
+
+  EvaluateGates(aNets.data(), 0, GetNumGates());
+
+  for( int o=0; o<GetNumOutputs(); ++o )
+    apOutputs[o] = aNets[mpOutputs[o]];
+}
+//---
+void cNetlist::EvaluateGates( cLogic::tPackedLevel* apNets, int aFirstGate, int aEndGate ) const {
+
+  const std::uint8_t* pOpcodes = mpOpcodes;
+  const std::int32_t* pInputA = mpInputA;
+  const std::int32_t* pInputB = mpInputB;
+  const std::int32_t* pOutput = mpOutputNet;
+
+  for( int g=aFirstGate; g<aEndGate; ++g ) {
+    // Unused inputs are -1; read net 0 instead so the loop stays branch-free per operand
+    const cLogic::tPackedLevel A = apNets[pInputA[g] >= 0 ? pInputA[g] : 0];
+    const cLogic::tPackedLevel B = apNets[pInputB[g] >= 0 ? pInputB[g] : 0];
+    cLogic::tPackedLevel Out = 0;
+    switch( pOpcodes[g] ) {
+      case OP_AND:    Out = A & B;    break;
+      case OP_OR:     Out = A | B;    break;
+      case OP_XOR:    Out = A ^ B;    break;
+      case OP_NAND:   Out = ~(A & B); break;
+      case OP_NOR:    Out = ~(A | B); break;
+      case OP_XNOR:   Out = ~(A ^ B); break;
+      case OP_NOT:    Out = ~A;       break;
+      case OP_BUF:    Out = A;        break;
+      case OP_CONST0: Out = 0;        break;
+      case OP_CONST1: Out = ~cLogic::tPackedLevel(0); break;
+    }
+    apNets[pOutput[g]] = Out;
+  }
+}
+
+//---
+void cNetlist::EvaluateDualRail( const cDualRailSignals& aInputs, cDualRailSignals& aOutputs, cDualRailSignals& aNets ) const {
+
+  const int Words = aInputs.GetWords();
+  if( aNets.GetNumSignals() != GetNumNets() || aNets.GetWords() != Words )
+    aNets.Resize(GetNumNets(), Words);
+  if( aOutputs.GetNumSignals() != GetNumOutputs() || aOutputs.GetWords() != Words )
+    aOutputs.Resize(GetNumOutputs(), Words);
+
+  for( int i=0; i<mNumInputs; ++i ) {
+    std::copy(aInputs.Value(i), aInputs.Value(i) + Words, aNets.Value(i));
+    std::copy(aInputs.Unknown(i), aInputs.Unknown(i) + Words, aNets.Unknown(i));
+  }
+
+  // Each gate is one kernel call over all lanes of its two input nets
+  for( int g=0; g<GetNumGates(); ++g ) {
+    const int A = mpInputA[g] >= 0 ? mpInputA[g] : 0;
+    const int B = mpInputB[g] >= 0 ? mpInputB[g] : 0;
+    cDualRail::Apply( GetOpcode(g), aNets.Value(A), aNets.Unknown(A), aNets.Value(B), aNets.Unknown(B),
+                      aNets.Value(mpOutputNet[g]), aNets.Unknown(mpOutputNet[g]), Words );
+  }
+
+  for( int o=0; o<GetNumOutputs(); ++o ) {
+    std::copy(aNets.Value(mpOutputs[o]), aNets.Value(mpOutputs[o]) + Words, aOutputs.Value(o));
+    std::copy(aNets.Unknown(mpOutputs[o]), aNets.Unknown(mpOutputs[o]) + Words, aOutputs.Unknown(o));
+  }
+}
+
+
+//---cCompiledCircuit Implementation-------------------------------------------
+cCompiledCircuit::cCompiledCircuit( const cLogicGate& aSource )
+  : cLogicGate( aSource.GetNumInputs(), aSource.GetNumOutputs() ),
+    mOutputLevels( aSource.GetNumOutputs(), cLogic::LOGIC_UNDEFINED ) {
+
+  mValid = mNetlist.Compile(aSource);
+}
+//---
+void cCompiledCircuit::ComputeOutput() {
+
+  if( !mValid )
+    return;
+
+  mNetlist.Evaluate(mInputs.data(), mOutputLevels.data(), mNets);
+
+  for( int o=0; o<GetNumOutputs(); ++o )
+    SetOutput( o, mOutputLevels[o] ); // Store and drive output wire
+}
+//---
+void cCompiledCircuit::ComputePacked( const cLogic::tPackedLevel* apInputs, cLogic::tPackedLevel* apOutputs ) {
+
+  if( mValid )
+    mNetlist.EvaluatePacked(apInputs, apOutputs, mPackedNets);
+}
+//---
+bool cCompiledCircuit::Flatten( cNetlist& aNetlist, const int* apInputNets, int* apOutputNets ) const {
+
+  if( !mValid )
+    return false;
+
+  // Copy the compiled gates, mapping their nets into the enclosing netlist
+  std::vector<int> NetMap(mNetlist.GetNumNets());
+  std::copy(apInputNets, apInputNets + mNetlist.GetNumInputs(), NetMap.begin());
+
+  for( int g=0; g<mNetlist.GetNumGates(); ++g ) {
+    const int A = mNetlist.GetInputA(g);
+    const int B = mNetlist.GetInputB(g);
+    NetMap[mNetlist.GetOutputNet(g)] = aNetlist.AddGate( mNetlist.GetOpcode(g), A >= 0 ? NetMap[A] : -1, B >= 0 ? NetMap[B] : -1, mNetlist.GetDelay(g) );
+  }
+
+  for( int o=0; o<mNetlist.GetNumOutputs(); ++o )
+    apOutputNets[o] = NetMap[mNetlist.GetOutput(o)];
+  return true;
+}
@@ -0,0 +1,144 @@
+// File: netlist.hpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Header file for the compiled (flattened, levelized) netlist and its cLogicGate wrapper.
+
+#ifndef NETLIST_HPP
+#define NETLIST_HPP
+
+#include "logic_gates.hpp"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class cDualRailSignals;
+class cMappedFile;
+
+// cNetlist holds any gate or subcircuit flattened into primitive gates.
+// Gates are stored in structure-of-arrays form and sorted by logic level, so a
+// single loop over the arrays evaluates the whole circuit with no virtual calls.
+// After Levelize, nets 0..NumInputs-1 are the primary inputs and gate g drives net NumInputs+g.
+// A levelized netlist can be saved as a binary image; MapImage then evaluates straight
+// from the mapped file, so large designs load without parsing or copying.
+class cNetlist {
+    public:
+        // eOpcode: Primitive operations a compiled gate can perform
+        enum eOpcode : std::uint8_t {
+            OP_AND,     // A & B
+            OP_OR,      // A | B
+            OP_XOR,     // A ^ B
+            OP_NAND,    // ~(A & B)
+            OP_NOR,     // ~(A | B)
+            OP_XNOR,    // ~(A ^ B)
+            OP_NOT,     // ~A
+            OP_BUF,     // A
+            OP_CONST0,  // Constant LOW, no inputs
+            OP_CONST1   // Constant HIGH, no inputs
+        };
+
+        // cImageStamp: Identifies the source an image was built from, so a stale image can be rejected
+        class cImageStamp {
+            public:
+                std::uint64_t mSize;        // Source size in bytes
+                std::int64_t mSeconds;      // Source modification time
+                std::uint32_t mNanoseconds;
+        };
+
+        cNetlist(); // Constructor
+        ~cNetlist() {}
+        cNetlist( const cNetlist& aOther );            // Copies share a mapped image
+        cNetlist& operator=( const cNetlist& aOther );
+
+        bool Compile( const cLogicGate& aCircuit ); // Flattens aCircuit into this netlist, replacing any previous content
+        void Clear(); // Removes all nets and gates
+
+        // Construction interface, used by cLogicGate::Flatten
+        int AddInput(); // Adds a primary input and returns its net
+        int AddGate( eOpcode aOpcode, int aInputA = -1, int aInputB = -1, int aDelay = 0 ); // Adds a primitive and returns its output net
+        void AddOutput( int aNet ); // Marks a net as the next primary output
+        bool Levelize(); // Sorts gates topologically by level and renumbers nets; false on a combinational loop
+
+        // Binary images of a levelized netlist
+        bool WriteImage( const char* apPath, const cImageStamp& aStamp = cImageStamp() ) const; // Saves the netlist tagged with aStamp; false if it cannot be written
+        bool MapImage( const char* apPath, const cImageStamp* apStamp = nullptr ); // Replaces the netlist with a mapped image, used in place; false if missing, invalid or not tagged with *apStamp
+        bool IsMapped() const { return mpImage != nullptr; } // Arrays live in a mapped image rather than owned storage
+
+        // Evaluation: aNets is caller-owned scratch so one netlist can be shared between simulations
+        void Evaluate( const cLogic::eLogicLevel* apInputs, cLogic::eLogicLevel* apOutputs, std::vector<cLogic::eLogicLevel>& aNets ) const;
+        void EvaluatePacked( const cLogic::tPackedLevel* apInputs, cLogic::tPackedLevel* apOutputs, std::vector<cLogic::tPackedLevel>& aNets ) const;
+        void EvaluateGates( cLogic::tPackedLevel* apNets, int aFirstGate, int aEndGate ) const; // Evaluates a gate range in place
+        void EvaluateDualRail( const cDualRailSignals& aInputs, cDualRailSignals& aOutputs, cDualRailSignals& aNets ) const; // Three-valued, every lane at once
+
+        // Netlist shape
+        int GetNumInputs() const { return mNumInputs; }
+        int GetNumOutputs() const { return mNumOutputs; }
+        int GetNumGates() const { return mNumGates; }
+        int GetNumNets() const { return mNumNets; }
+        int GetNumLevels() const { return mNumLevels; } // Logic depth after Levelize
+        int GetLevelBegin( int aLevel ) const { return mpLevelStart[aLevel]; }  // First gate of level aLevel (0-based)
+        int GetLevelEnd( int aLevel ) const { return mpLevelStart[aLevel + 1]; } // One past the last gate of level aLevel
+
+        // Gate arrays
+        eOpcode GetOpcode( int aGate ) const { return static_cast<eOpcode>(mpOpcodes[aGate]); }
+        int GetInputA( int aGate ) const { return mpInputA[aGate]; }
+        int GetInputB( int aGate ) const { return mpInputB[aGate]; }
+        int GetOutputNet( int aGate ) const { return mpOutputNet[aGate]; }
+        int GetOutput( int aOutputIndex ) const { return mpOutputs[aOutputIndex]; } // Net driving a primary output
+        int GetDelay( int aGate ) const { return mDelays.empty() ? 0 : mDelays[aGate]; } // Delay given to AddGate (0: default; images do not store delays)
+
+        static int GetOpcodeInputs( eOpcode aOpcode ); // Number of inputs a primitive reads (0, 1 or 2)
+
+    private:
+        void BindArrays(); // Points the array views at the owned vectors
+        void Unmap(); // Copies a mapped image into owned storage so it can be modified
+
+        int mNumInputs;                          // Number of primary inputs
+        int mNumNets;                            // Number of nets (inputs plus gate outputs)
+        int mNumGates;                           // Number of gates
+        int mNumOutputs;                         // Number of primary outputs
+        int mNumLevels;                          // Logic depth
+
+        // Views read by every accessor and evaluator: the owned vectors below, or a mapped image
+        const std::uint8_t* mpOpcodes;
+        const std::int32_t* mpInputA;
+        const std::int32_t* mpInputB;
+        const std::int32_t* mpOutputNet;
+        const std::int32_t* mpOutputs;
+        const std::int32_t* mpLevelStart;
+        std::shared_ptr<const cMappedFile> mpImage; // Mapped image the views point into, if any
+
+        // Owned storage, empty while an image is mapped
+        std::vector<std::int32_t> mInputNets;    // Net of each primary input (0..NumInputs-1 once levelized)
+        std::vector<std::uint8_t> mOpcodes;      // Operation of each gate
+        std::vector<std::int32_t> mInputA;       // First input net of each gate (-1 if unused)
+        std::vector<std::int32_t> mInputB;       // Second input net of each gate (-1 if unused)
+        std::vector<std::int32_t> mOutputNet;    // Net driven by each gate
+        std::vector<std::uint16_t> mDelays;      // Propagation delay of each gate, for timing simulation only
+        std::vector<std::int32_t> mOutputs;      // Nets driving the primary outputs
+        std::vector<std::int32_t> mLevelStart;   // Index of the first gate of each level, plus an end marker
+};
+
+
+// cCompiledCircuit exposes a compiled netlist through the cLogicGate interface,
+// so a flattened circuit can be used anywhere the original could.
+class cCompiledCircuit : public cLogicGate {
+    public:
+        explicit cCompiledCircuit( const cLogicGate& aSource ); // Compiles aSource into an internal netlist
+        virtual ~cCompiledCircuit() {}
+
+        void ComputeOutput() override; // Evaluate the netlist for the current inputs
+        void ComputePacked( const cLogic::tPackedLevel* apInputs, cLogic::tPackedLevel* apOutputs ) override; // Evaluate 64 vectors
+        bool Flatten( cNetlist& aNetlist, const int* apInputNets, int* apOutputNets ) const override; // Inline the compiled gates
+
+        bool IsValid() const { return mValid; }            // False if the source could not be flattened
+        const cNetlist& GetNetlist() const { return mNetlist; }
+
+    private:
+        cNetlist mNetlist;                                   // Flattened form of the source circuit
+        bool mValid;                                         // Compilation succeeded
+        std::vector<cLogic::eLogicLevel> mNets;              // Scratch net values for scalar evaluation
+        std::vector<cLogic::eLogicLevel> mOutputLevels;      // Scratch output values for scalar evaluation
+        std::vector<cLogic::tPackedLevel> mPackedNets;       // Scratch net values for packed evaluation
+};
+
+#endif // NETLIST_HPP
@@ -0,0 +1,576 @@
+// File: netlist_reader.cpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Implementation file for cNetlistReader.
+
+//--Includes-------------------------------------------------------------------
+#include "netlist_reader.hpp"
+#include <cctype>
+#include <cstring>
+#include <sys/stat.h>
+
+//---Local helpers-------------------------------------------------------------
+namespace {
+
+bool IsSpace( char aChar ) {
+    return aChar == ' ' || aChar == '\t' || aChar == '\r' || aChar == '\f' || aChar == '\v';
+}
+
+std::string_view Trim( std::string_view aText ) {
+    while (!aText.empty() && IsSpace(aText.front()))
+        aText.remove_prefix(1);
+    while (!aText.empty() && IsSpace(aText.back()))
+        aText.remove_suffix(1);
+    return aText;
+}
+
+bool EqualsNoCase( std::string_view aText, const char* apWord ) {
+    const size_t Length = std::strlen(apWord);
+    if (aText.size() != Length)
+        return false;
+    for (size_t i = 0; i < Length; ++i) {
+        if (std::toupper(static_cast<unsigned char>(aText[i])) != apWord[i])
+            return false;
+    }
+    return true;
+}
+
+// Gate keyword of a .bench line; false for anything else (including DFF)
+bool BenchOpcode( std::string_view aWord, cNetlist::eOpcode& aOpcode ) {
+    static const struct { const char* mpName; cNetlist::eOpcode mOpcode; } Keywords[] = {
+        { "AND", cNetlist::OP_AND },   { "NAND", cNetlist::OP_NAND }, { "OR", cNetlist::OP_OR },
+        { "NOR", cNetlist::OP_NOR },   { "XOR", cNetlist::OP_XOR },   { "XNOR", cNetlist::OP_XNOR },
+        { "NOT", cNetlist::OP_NOT },   { "BUF", cNetlist::OP_BUF },   { "BUFF", cNetlist::OP_BUF }
+    };
+    for (const auto& Keyword : Keywords) {
+        if (EqualsNoCase(aWord, Keyword.mpName)) {
+            aOpcode = Keyword.mOpcode;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Emits one recorded gate as two-input primitives through aSink, and returns the handle of
+// its result. N-input gates become a balanced tree of the base operation with the
+// inversion (if any) applied by the last gate. apFanin is overwritten.
+template<class tSink>
+int EmitCell( tSink& aSink, cNetlist::eOpcode aOpcode, int* apFanin, int aCount, int aTarget ) {
+    cNetlist::eOpcode Base = aOpcode;
+    bool Invert = false;
+    switch (aOpcode) {
+        case cNetlist::OP_NAND: Base = cNetlist::OP_AND; Invert = true; break;
+        case cNetlist::OP_NOR:  Base = cNetlist::OP_OR;  Invert = true; break;
+        case cNetlist::OP_XNOR: Base = cNetlist::OP_XOR; Invert = true; break;
+        case cNetlist::OP_NOT:
+        case cNetlist::OP_BUF:    return aSink.Emit(aOpcode, apFanin[0], -1, aTarget);
+        case cNetlist::OP_CONST0:
+        case cNetlist::OP_CONST1: return aSink.Emit(aOpcode, -1, -1, aTarget);
+        default: break;
+    }
+
+    if (aCount == 1)
+        return aSink.Emit(Invert ? cNetlist::OP_NOT : cNetlist::OP_BUF, apFanin[0], -1, aTarget);
+
+    while (aCount > 2) {
+        int Reduced = 0;
+        for (int i = 0; i + 1 < aCount; i += 2)
+            apFanin[Reduced++] = aSink.Emit(Base, apFanin[i], apFanin[i + 1], -1);
+        if (aCount % 2 != 0)
+            apFanin[Reduced++] = apFanin[aCount - 1];
+        aCount = Reduced;
+    }
+    return aSink.Emit(aOpcode, apFanin[0], apFanin[1], aTarget);
+}
+
+// cNetworkSink: Emits primitives as gate objects; handles are wire indices
+class cNetworkSink {
+    public:
+        explicit cNetworkSink( cGateNetwork& aNetwork ) : mNetwork(aNetwork) {}
+
+        int Emit( cNetlist::eOpcode aOpcode, int aA, int aB, int aTarget ) {
+            const int Out = aTarget >= 0 ? aTarget : mNetwork.AddWire();
+            switch (aOpcode) {
+                case cNetlist::OP_AND:    mNetwork.CreateGate<cAndGate>({ aA, aB }, { Out }); break;
+                case cNetlist::OP_OR:     mNetwork.CreateGate<cOrGate>({ aA, aB }, { Out }); break;
+                case cNetlist::OP_XOR:    mNetwork.CreateGate<cXorGate>({ aA, aB }, { Out }); break;
+                case cNetlist::OP_NAND:   mNetwork.CreateGate<cNandGate>({ aA, aB }, { Out }); break;
+                case cNetlist::OP_NOR:    mNetwork.CreateGate<cNorGate>({ aA, aB }, { Out }); break;
+                case cNetlist::OP_XNOR:   mNetwork.CreateGate<cXnorGate>({ aA, aB }, { Out }); break;
+                case cNetlist::OP_NOT:    mNetwork.CreateGate<cNotGate>({ aA }, { Out }); break;
+                case cNetlist::OP_BUF:    mNetwork.CreateGate<cBufGate>({ aA }, { Out }); break;
+                case cNetlist::OP_CONST0: mNetwork.CreateGate<cConstantGate>({}, { Out }, cLogic::LOGIC_LOW); break;
+                case cNetlist::OP_CONST1: mNetwork.CreateGate<cConstantGate>({}, { Out }, cLogic::LOGIC_HIGH); break;
+            }
+            return Out;
+        }
+
+    private:
+        cGateNetwork& mNetwork; // Network being built
+};
+
+// cNetlistSink: Emits primitives straight into a compiled netlist; handles are nets.
+// Buffers are free here, so their output simply aliases the input net.
+class cNetlistSink {
+    public:
+        explicit cNetlistSink( cNetlist& aNetlist ) : mNetlist(aNetlist) {}
+
+        int Emit( cNetlist::eOpcode aOpcode, int aA, int aB, int /*aTarget*/ ) {
+            if (aOpcode == cNetlist::OP_BUF)
+                return aA;
+            return mNetlist.AddGate(aOpcode, aA, aB);
+        }
+
+    private:
+        cNetlist& mNetlist; // Netlist being built
+};
+
+} // namespace
+
+
+//---cNetlistReader Implementation---------------------------------------------
+cNetlistReader::cNetlistReader() : mLine(0), mValid(false) {
+    Reset();
+}
+//---
+void cNetlistReader::Reset() {
+    mSignalIds.clear();
+    mSignalNames.clear();
+    mSignalDriver.clear();
+    mSignalInverse.clear();
+    mIsInput.clear();
+    mInputs.clear();
+    mOutputs.clear();
+    mCellOps.clear();
+    mCellOutput.clear();
+    mCellFaninStart.assign(1, 0);
+    mCellFanin.clear();
+    mLine = 0;
+    mValid = false;
+    mError.clear();
+}
+//---
+bool cNetlistReader::Read( const char* apPath, eFormat aFormat ) {
+    Reset();
+    if (!mFile.Open(apPath))
+        return Fail(std::string("cannot open ") + apPath);
+
+    if (aFormat == FORMAT_AUTO) {
+        const size_t Length = std::strlen(apPath);
+        aFormat = Length >= 5 && std::strcmp(apPath + Length - 5, ".blif") == 0 ? FORMAT_BLIF : FORMAT_BENCH;
+    }
+    return Parse(mFile.GetData(), mFile.GetSize(), aFormat);
+}
+//---
+bool cNetlistReader::Parse( const char* apText, size_t aLength, eFormat aFormat ) {
+    Reset();
+
+    // Roughly one signal per short line; avoids rehashing while the table fills
+    mSignalIds.reserve(aLength / 24 + 16);
+
+    const bool Parsed = aFormat == FORMAT_BLIF ? ParseBlif(apText, apText + aLength)
+                                               : ParseBench(apText, apText + aLength);
+    mValid = Parsed && Check();
+    return mValid;
+}
+//---
+int cNetlistReader::FindSignal( std::string_view aName ) {
+    const auto Found = mSignalIds.find(aName);
+    if (Found != mSignalIds.end())
+        return Found->second;
+
+    const int Signal = NewSignal();
+    mSignalNames[Signal] = aName;
+    mSignalIds.emplace(aName, Signal);
+    return Signal;
+}
+//---
+int cNetlistReader::NewSignal() {
+    mSignalNames.emplace_back();
+    mSignalDriver.push_back(-1);
+    mSignalInverse.push_back(-1);
+    mIsInput.push_back(0);
+    return GetNumSignals() - 1;
+}
+//---
+bool cNetlistReader::AddCell( cNetlist::eOpcode aOpcode, int aOutput, const int* apFanin, int aNumFanin ) {
+    if (mSignalDriver[aOutput] >= 0 || mIsInput[aOutput])
+        return Fail("signal '" + std::string(mSignalNames[aOutput]) + "' has more than one driver");
+
+    const int Expected = cNetlist::GetOpcodeInputs(aOpcode);
+    if ((Expected < 2 && aNumFanin != Expected) || (Expected == 2 && aNumFanin < 1))
+        return Fail("wrong number of inputs for gate driving '" + std::string(mSignalNames[aOutput]) + "'");
+
+    mSignalDriver[aOutput] = GetNumGates();
+    mCellOps.push_back(aOpcode);
+    mCellOutput.push_back(aOutput);
+    mCellFanin.insert(mCellFanin.end(), apFanin, apFanin + aNumFanin);
+    mCellFaninStart.push_back(static_cast<int>(mCellFanin.size()));
+    return true;
+}
+//---
+bool cNetlistReader::Fail( const std::string& aMessage ) {
+    mError = mLine > 0 ? "line " + std::to_string(mLine) + ": " + aMessage : aMessage;
+    return false;
+}
+//---
+bool cNetlistReader::ParseBench( const char* apText, const char* apEnd ) {
+    std::vector<int> Fanin;
+
+    for (const char* pLine = apText; pLine < apEnd; ) {
+        const char* pNewline = static_cast<const char*>(std::memchr(pLine, '\n', apEnd - pLine));
+        const char* pLineEnd = pNewline != nullptr ? pNewline : apEnd;
+        std::string_view Line(pLine, pLineEnd - pLine);
+        pLine = pLineEnd + 1;
+        ++mLine;
+
+        const size_t Comment = Line.find('#');
+        if (Comment != std::string_view::npos)
+            Line = Line.substr(0, Comment);
+        Line = Trim(Line);
+        if (Line.empty())
+            continue;
+
+        const size_t Open = Line.find('(');
+        const size_t Close = Line.rfind(')');
+        if (Open == std::string_view::npos || Close == std::string_view::npos || Close < Open)
+            return Fail("expected 'NAME = GATE(...)', INPUT(...) or OUTPUT(...)");
+        const std::string_view Arguments = Line.substr(Open + 1, Close - Open - 1);
+        const size_t Equals = Line.find('=');
+
+        if (Equals == std::string_view::npos || Equals > Open) {
+            // INPUT(name) or OUTPUT(name)
+            const std::string_view Keyword = Trim(Line.substr(0, Open));
+            const std::string_view Name = Trim(Arguments);
+            if (Name.empty())
+                return Fail("missing signal name");
+            if (EqualsNoCase(Keyword, "INPUT")) {
+                const int Signal = FindSignal(Name);
+                if (mIsInput[Signal] || mSignalDriver[Signal] >= 0)
+                    return Fail("input '" + std::string(Name) + "' is already driven");
+                mIsInput[Signal] = 1;
+                mInputs.push_back(Signal);
+            }
+            else if (EqualsNoCase(Keyword, "OUTPUT"))
+                mOutputs.push_back(FindSignal(Name));
+            else
+                return Fail("unknown declaration '" + std::string(Keyword) + "'");
+            continue;
+        }
+
+        // name = GATE(a, b, ...)
+        const std::string_view Target = Trim(Line.substr(0, Equals));
+        const std::string_view Type = Trim(Line.substr(Equals + 1, Open - Equals - 1));
+        cNetlist::eOpcode Opcode;
+        if (!BenchOpcode(Type, Opcode)) {
+            if (EqualsNoCase(Type, "DFF"))
+                return Fail("sequential element DFF is not supported");
+            return Fail("unknown gate type '" + std::string(Type) + "'");
+        }
+
+        Fanin.clear();
+        std::string_view Rest = Arguments;
+        while (!Rest.empty()) {
+            const size_t Comma = Rest.find(',');
+            const std::string_view Name = Trim(Rest.substr(0, Comma));
+            if (Name.empty())
+                return Fail("empty gate input");
+            Fanin.push_back(FindSignal(Name));
+            Rest = Comma == std::string_view::npos ? std::string_view() : Rest.substr(Comma + 1);
+        }
+        if (Target.empty() || !AddCell(Opcode, FindSignal(Target), Fanin.data(), static_cast<int>(Fanin.size())))
+            return mError.empty() ? Fail("missing gate output name") : false;
+    }
+    return true;
+}
+//---
+bool cNetlistReader::ParseBlif( const char* apText, const char* apEnd ) {
+    std::vector<std::string_view> Tokens;   // Current logical line
+    std::vector<int> Fanin;                 // Inputs of the open .names cover
+    std::vector<std::string_view> Rows;     // Rows of the open .names cover
+    int CoverOutput = -1;                   // Output of the open .names cover, -1 if none
+    bool Ended = false;
+
+    const char* p = apText;
+    while (p < apEnd && !Ended) {
+        // Gather one logical line: '\' before a newline continues it, '#' starts a comment
+        Tokens.clear();
+        const int FirstLine = ++mLine;
+        while (p < apEnd && *p != '\n') {
+            if (*p == '\\' && (p + 1 == apEnd || p[1] == '\n' || (p[1] == '\r' && p + 2 < apEnd && p[2] == '\n'))) {
+                p = static_cast<const char*>(std::memchr(p, '\n', apEnd - p));
+                p = p != nullptr ? p + 1 : apEnd;
+                ++mLine;
+                continue;
+            }
+            if (*p == '#') {
+                while (p < apEnd && *p != '\n')
+                    ++p;
+                break;
+            }
+            if (IsSpace(*p)) {
+                ++p;
+                continue;
+            }
+            const char* pToken = p;
+            while (p < apEnd && *p != '\n' && *p != '#' && !IsSpace(*p) && *p != '\\')
+                ++p;
+            if (p == pToken)
+                ++p; // A lone backslash inside a line
+            Tokens.emplace_back(pToken, p - pToken);
+        }
+        if (p < apEnd)
+            ++p; // Newline
+        if (Tokens.empty())
+            continue;
+
+        if (Tokens[0][0] != '.') {
+            if (CoverOutput < 0)
+                return Fail("cover row outside a .names block");
+            if (static_cast<int>(Tokens.size()) != (Fanin.empty() ? 1 : 2))
+                return Fail("malformed cover row");
+            Rows.insert(Rows.end(), Tokens.begin(), Tokens.end());
+            continue;
+        }
+
+        // Any directive closes the open cover
+        if (CoverOutput >= 0) {
+            const int SavedLine = mLine;
+            mLine = FirstLine - 1;
+            if (!AddCover(CoverOutput, Fanin, Rows))
+                return false;
+            mLine = SavedLine;
+            CoverOutput = -1;
+        }
+
+        const std::string_view Directive = Tokens[0];
+        if (Directive == ".inputs") {
+            for (size_t t = 1; t < Tokens.size(); ++t) {
+                const int Signal = FindSignal(Tokens[t]);
+                if (mIsInput[Signal] || mSignalDriver[Signal] >= 0)
+                    return Fail("input '" + std::string(Tokens[t]) + "' is already driven");
+                mIsInput[Signal] = 1;
+                mInputs.push_back(Signal);
+            }
+        }
+        else if (Directive == ".outputs") {
+            for (size_t t = 1; t < Tokens.size(); ++t)
+                mOutputs.push_back(FindSignal(Tokens[t]));
+        }
+        else if (Directive == ".names") {
+            if (Tokens.size() < 2)
+                return Fail(".names needs an output");
+            Fanin.clear();
+            for (size_t t = 1; t + 1 < Tokens.size(); ++t)
+                Fanin.push_back(FindSignal(Tokens[t]));
+            CoverOutput = FindSignal(Tokens.back());
+            Rows.clear();
+        }
+        else if (Directive == ".end")
+            Ended = true;
+        else if (Directive == ".latch" || Directive == ".mlatch" || Directive == ".subckt" || Directive == ".gate")
+            return Fail(std::string(Directive) + " is not supported");
+        // .model, .exdc, timing and other annotations do not change the logic
+    }
+
+    if (CoverOutput >= 0)
+        return AddCover(CoverOutput, Fanin, Rows);
+    return true;
+}
+//---
+bool cNetlistReader::AddCover( int aOutput, const std::vector<int>& aFanin, const std::vector<std::string_view>& aRows ) {
+    const int NumInputs = static_cast<int>(aFanin.size());
+    const int RowTokens = NumInputs == 0 ? 1 : 2;
+    const int NumRows = static_cast<int>(aRows.size()) / RowTokens;
+
+    // All rows list the on-set ('1') or all list the off-set ('0')
+    char Phase = '1';
+    for (int r = 0; r < NumRows; ++r) {
+        const std::string_view Value = aRows[r * RowTokens + RowTokens - 1];
+        if (Value.size() != 1 || (Value[0] != '0' && Value[0] != '1'))
+            return Fail("cover output must be 0 or 1");
+        if (r > 0 && Value[0] != Phase)
+            return Fail("cover mixes on-set and off-set rows");
+        Phase = Value[0];
+    }
+
+    // Terms are the cube signals ORed together; a cube with no literals makes the cover constant
+    std::vector<int> Terms, Literals;
+    bool Tautology = false;
+    for (int r = 0; r < NumRows && !Tautology; ++r) {
+        Literals.clear();
+        if (NumInputs > 0) {
+            const std::string_view Cube = aRows[r * 2];
+            if (static_cast<int>(Cube.size()) != NumInputs)
+                return Fail("cube width does not match the .names inputs");
+            for (int i = 0; i < NumInputs; ++i) {
+                if (Cube[i] == '1')
+                    Literals.push_back(aFanin[i]);
+                else if (Cube[i] == '0')
+                    Literals.push_back(Inverted(aFanin[i]));
+                else if (Cube[i] != '-')
+                    return Fail("cube characters must be 0, 1 or -");
+            }
+        }
+
+        if (Literals.empty())
+            Tautology = true;
+        else if (Literals.size() == 1)
+            Terms.push_back(Literals[0]);
+        else {
+            const int Term = NewSignal();
+            if (!AddCell(cNetlist::OP_AND, Term, Literals.data(), static_cast<int>(Literals.size())))
+                return false;
+            Terms.push_back(Term);
+        }
+    }
+
+    const bool OnSet = (Phase == '1');
+    if (Tautology || Terms.empty()) {
+        // Empty cover is 0; a full cube is 1; an off-set cover inverts either
+        const bool High = Tautology == OnSet;
+        return AddCell(High ? cNetlist::OP_CONST1 : cNetlist::OP_CONST0, aOutput, nullptr, 0);
+    }
+    return AddCell(OnSet ? cNetlist::OP_OR : cNetlist::OP_NOR, aOutput, Terms.data(), static_cast<int>(Terms.size()));
+}
+//---
+int cNetlistReader::Inverted( int aSignal ) {
+    if (mSignalInverse[aSignal] < 0) {
+        const int Inverse = NewSignal();
+        AddCell(cNetlist::OP_NOT, Inverse, &aSignal, 1);
+        mSignalInverse[aSignal] = Inverse;
+    }
+    return mSignalInverse[aSignal];
+}
+//---
+bool cNetlistReader::Check() {
+    mLine = 0;
+    std::vector<std::uint8_t> Used(GetNumSignals(), 0);
+    for (int Signal : mCellFanin)
+        Used[Signal] = 1;
+    for (int Signal : mOutputs)
+        Used[Signal] = 1;
+
+    for (int s = 0; s < GetNumSignals(); ++s) {
+        if (Used[s] && !mIsInput[s] && mSignalDriver[s] < 0)
+            return Fail("signal '" + std::string(mSignalNames[s]) + "' is never driven");
+    }
+    return true;
+}
+//---
+std::unique_ptr<cGateNetwork> cNetlistReader::BuildNetwork() const {
+    if (!mValid)
+        return nullptr;
+
+    std::unique_ptr<cGateNetwork> pNetwork(new cGateNetwork(GetNumInputs(), GetNumOutputs()));
+    std::vector<int> Wire(GetNumSignals(), -1);
+    for (int i = 0; i < GetNumInputs(); ++i)
+        Wire[mInputs[i]] = i;
+    for (int s = 0; s < GetNumSignals(); ++s) {
+        if (Wire[s] < 0 && mSignalDriver[s] >= 0)
+            Wire[s] = pNetwork->AddWire();
+    }
+
+    // Every wire exists up front, so gates can be added in file order
+    cNetworkSink Sink(*pNetwork);
+    std::vector<int> Fanin;
+    for (int c = 0; c < GetNumGates(); ++c) {
+        Fanin.clear();
+        for (int f = mCellFaninStart[c]; f < mCellFaninStart[c + 1]; ++f)
+            Fanin.push_back(Wire[mCellFanin[f]]);
+        EmitCell(Sink, static_cast<cNetlist::eOpcode>(mCellOps[c]), Fanin.data(), static_cast<int>(Fanin.size()), Wire[mCellOutput[c]]);
+    }
+
+    for (int o = 0; o < GetNumOutputs(); ++o)
+        pNetwork->SetOutputWire(o, Wire[mOutputs[o]]);
+    pNetwork->Finalize();
+    return pNetwork;
+}
+//---
+bool cNetlistReader::BuildNetlist( cNetlist& aNetlist ) const {
+    aNetlist.Clear();
+    if (!mValid)
+        return false;
+
+    // Nets are created as gates are emitted, so emit every gate after its drivers (Kahn's algorithm)
+    const int NumGates = GetNumGates();
+    std::vector<int> Pending(NumGates, 0);
+    std::vector<int> LoadStart(GetNumSignals() + 1, 0);
+    for (int c = 0; c < NumGates; ++c) {
+        for (int f = mCellFaninStart[c]; f < mCellFaninStart[c + 1]; ++f) {
+            if (mSignalDriver[mCellFanin[f]] >= 0) {
+                ++Pending[c];
+                ++LoadStart[mCellFanin[f] + 1];
+            }
+        }
+    }
+    for (int s = 0; s < GetNumSignals(); ++s)
+        LoadStart[s + 1] += LoadStart[s];
+    std::vector<int> Loads(LoadStart.back());
+    std::vector<int> Fill(LoadStart.begin(), LoadStart.end() - 1);
+    for (int c = 0; c < NumGates; ++c) {
+        for (int f = mCellFaninStart[c]; f < mCellFaninStart[c + 1]; ++f) {
+            if (mSignalDriver[mCellFanin[f]] >= 0)
+                Loads[Fill[mCellFanin[f]]++] = c;
+        }
+    }
+
+    std::vector<int> Order;
+    Order.reserve(NumGates);
+    for (int c = 0; c < NumGates; ++c) {
+        if (Pending[c] == 0)
+            Order.push_back(c);
+    }
+    for (size_t i = 0; i < Order.size(); ++i) {
+        const int Output = mCellOutput[Order[i]];
+        for (int l = LoadStart[Output]; l < LoadStart[Output + 1]; ++l) {
+            if (--Pending[Loads[l]] == 0)
+                Order.push_back(Loads[l]);
+        }
+    }
+    if (static_cast<int>(Order.size()) != NumGates)
+        return false; // Combinational loop
+
+    std::vector<int> Net(GetNumSignals(), -1);
+    for (int Signal : mInputs)
+        Net[Signal] = aNetlist.AddInput();
+
+    cNetlistSink Sink(aNetlist);
+    std::vector<int> Fanin;
+    for (int c : Order) {
+        Fanin.clear();
+        for (int f = mCellFaninStart[c]; f < mCellFaninStart[c + 1]; ++f)
+            Fanin.push_back(Net[mCellFanin[f]]);
+        Net[mCellOutput[c]] = EmitCell(Sink, static_cast<cNetlist::eOpcode>(mCellOps[c]), Fanin.data(), static_cast<int>(Fanin.size()), -1);
+    }
+
+    for (int Signal : mOutputs)
+        aNetlist.AddOutput(Net[Signal]);
+    return aNetlist.Levelize();
+}
+//---
+bool cNetlistReader::LoadCompiled( const char* apPath, cNetlist& aNetlist, std::string* apError ) {
+    const std::string ImagePath = std::string(apPath) + ".img";
+
+    // The image records the size and nanosecond modification time of the source it was built
+    // from, and is used only on an exact match, so an edit in the same second still reparses
+    struct stat Source;
+    cNetlist::cImageStamp Stamp = cNetlist::cImageStamp();
+    if (stat(apPath, &Source) == 0) {
+        Stamp.mSize = static_cast<std::uint64_t>(Source.st_size);
+        Stamp.mSeconds = static_cast<std::int64_t>(Source.st_mtim.tv_sec);
+        Stamp.mNanoseconds = static_cast<std::uint32_t>(Source.st_mtim.tv_nsec);
+        if (aNetlist.MapImage(ImagePath.c_str(), &Stamp))
+            return true;
+    }
+
+    cNetlistReader Reader;
+    if (!Reader.Read(apPath) || !Reader.BuildNetlist(aNetlist)) {
+        if (apError != nullptr)
+            *apError = Reader.GetError().empty() ? "combinational loop" : Reader.GetError();
+        return false;
+    }
+
+    aNetlist.WriteImage(ImagePath.c_str(), Stamp); // A missing cache only costs the next run a parse
+    return true;
+}
@@ -0,0 +1,89 @@
+// File: netlist_reader.hpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Header file for cNetlistReader, which loads ISCAS .bench and BLIF netlists.
+
+#ifndef NETLIST_READER_HPP
+#define NETLIST_READER_HPP
+
+#include "gate_network.hpp"
+#include "mapped_file.hpp"
+#include "netlist.hpp"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// cNetlistReader parses combinational .bench (ISCAS-85/89 style) and BLIF netlists.
+// The file is memory-mapped and signal names are kept as views into the mapping, so
+// parsing allocates little beyond the gate records themselves. Gates are recorded with
+// any number of inputs and decomposed into two-input primitives when a circuit is built.
+// BLIF covers (.names) become AND-OR logic with inverted literals.
+class cNetlistReader {
+    public:
+        // eFormat: Input syntax
+        enum eFormat {
+            FORMAT_AUTO,    // BLIF for a .blif extension, otherwise .bench
+            FORMAT_BENCH,   // INPUT(a) / OUTPUT(b) / b = NAND(a, c)
+            FORMAT_BLIF     // .inputs / .outputs / .names covers
+        };
+
+        cNetlistReader(); // Constructor
+        ~cNetlistReader() {}
+        cNetlistReader( const cNetlistReader& ) = delete;            // Names point into the mapped file
+        cNetlistReader& operator=( const cNetlistReader& ) = delete;
+
+        bool Read( const char* apPath, eFormat aFormat = FORMAT_AUTO ); // Maps and parses a file; false with GetError set on failure
+        bool Parse( const char* apText, size_t aLength, eFormat aFormat ); // Parses text that must outlive the reader
+
+        std::unique_ptr<cGateNetwork> BuildNetwork() const; // Event-driven network of primitive gates (nullptr before a successful parse)
+        bool BuildNetlist( cNetlist& aNetlist ) const; // Levelized compiled netlist; false on a combinational loop
+
+        // Loads apPath as a compiled netlist through a binary image cache: "<apPath>.img" is
+        // mapped in place when it was built from apPath's current size and modification time,
+        // otherwise the source is parsed and the image rewritten
+        static bool LoadCompiled( const char* apPath, cNetlist& aNetlist, std::string* apError = nullptr );
+
+        const std::string& GetError() const { return mError; } // Reason the last Read or Parse failed
+        int GetNumInputs() const { return static_cast<int>(mInputs.size()); }
+        int GetNumOutputs() const { return static_cast<int>(mOutputs.size()); }
+        int GetNumGates() const { return static_cast<int>(mCellOps.size()); }         // Gates as written, before decomposition
+        int GetNumSignals() const { return static_cast<int>(mSignalNames.size()); }   // Named and internal signals
+        std::string GetInputName( int aInput ) const { return std::string(mSignalNames[mInputs[aInput]]); }
+        std::string GetOutputName( int aOutput ) const { return std::string(mSignalNames[mOutputs[aOutput]]); }
+
+    private:
+        void Reset(); // Forgets any previous parse
+        int FindSignal( std::string_view aName ); // Id of a named signal, created on first use
+        int NewSignal(); // Creates an unnamed internal signal
+        bool AddCell( cNetlist::eOpcode aOpcode, int aOutput, const int* apFanin, int aNumFanin ); // Records a gate driving aOutput
+        bool Fail( const std::string& aMessage ); // Records an error at the current line and returns false
+        bool ParseBench( const char* apText, const char* apEnd );
+        bool ParseBlif( const char* apText, const char* apEnd );
+        bool AddCover( int aOutput, const std::vector<int>& aFanin, const std::vector<std::string_view>& aRows ); // Converts one BLIF .names cover
+        int Inverted( int aSignal ); // Shared NOT of a signal, for negative cover literals
+        bool Check(); // Every used signal is driven and no gate drives a primary input
+
+        cMappedFile mFile;                                      // Source text, when read from a file
+        std::unordered_map<std::string_view, int> mSignalIds;   // Named signal lookup
+        std::vector<std::string_view> mSignalNames;             // Name of each signal (empty when internal)
+        std::vector<int> mSignalDriver;                         // Gate driving each signal, -1 if none
+        std::vector<int> mSignalInverse;                        // Signal holding the NOT of each signal, -1 if none yet
+        std::vector<std::uint8_t> mIsInput;                     // Signal is a primary input
+        std::vector<int> mInputs;                               // Primary input signals, in declaration order
+        std::vector<int> mOutputs;                              // Primary output signals, in declaration order
+
+        // Gates in compressed-sparse-row form
+        std::vector<std::uint8_t> mCellOps;   // cNetlist::eOpcode of each gate (AND..XNOR may have any number of inputs)
+        std::vector<int> mCellOutput;         // Signal driven by each gate
+        std::vector<int> mCellFaninStart;     // Gate c reads mCellFanin[mCellFaninStart[c] .. mCellFaninStart[c+1])
+        std::vector<int> mCellFanin;          // Input signals of every gate
+
+        int mLine;              // Line being parsed, for error messages
+        bool mValid;            // Last parse succeeded
+        std::string mError;     // See GetError
+};
+
+#endif // NETLIST_READER_HPP
@@ -0,0 +1,164 @@
+// File: parallel_sim.cpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Implementation file for cParallelSimulator.
+
+//--Includes-------------------------------------------------------------------
+#include "parallel_sim.hpp"
+#include <algorithm>
+
+//---Local helpers-------------------------------------------------------------
+namespace {
+
+const std::uint64_t LowHalf = 0xFFFFFFFFull;
+
+std::uint64_t PackRange( std::uint64_t aBegin, std::uint64_t aEnd ) {
+    return (aBegin << 32) | aEnd;
+}
+
+// Lane patterns of the six inputs that vary within a block
+const cLogic::tPackedLevel LanePatterns[6] = {
+    0xAAAAAAAAAAAAAAAAull, 0xCCCCCCCCCCCCCCCCull, 0xF0F0F0F0F0F0F0F0ull,
+    0xFF00FF00FF00FF00ull, 0xFFFF0000FFFF0000ull, 0xFFFFFFFF00000000ull
+};
+
+} // namespace
+
+
+//---cParallelSimulator Implementation-----------------------------------------
+cParallelSimulator::cParallelSimulator( int aNumThreads )
+    : mPool(aNumThreads),
+      mChunkBlocks(16),
+      mQueues(mPool.GetNumThreads()),
+      mStats(mPool.GetNumThreads(), cWorkerStats{ 0, 0, 0 }) {}
+//---
+size_t cParallelSimulator::GetExhaustiveBlocks( int aNumInputs ) {
+    return aNumInputs <= 6 ? 1 : size_t(1) << (aNumInputs - 6);
+}
+//---
+void cParallelSimulator::MakeExhaustiveBlock( int aNumInputs, size_t aBlock, cLogic::tPackedLevel* apInputs ) {
+    for (int i = 0; i < aNumInputs; ++i) {
+        if (i < 6)
+            apInputs[i] = LanePatterns[i];
+        else
+            apInputs[i] = ((aBlock >> (i - 6)) & 1) ? ~cLogic::tPackedLevel(0) : 0;
+    }
+}
+//---
+bool cParallelSimulator::PopChunk( int aWorker, std::uint32_t& aChunk ) {
+    std::atomic<std::uint64_t>& Range = mQueues[aWorker].mRange;
+    std::uint64_t Current = Range.load(std::memory_order_acquire);
+    for (;;) {
+        const std::uint64_t Begin = Current >> 32, End = Current & LowHalf;
+        if (Begin >= End)
+            return false;
+        if (Range.compare_exchange_weak(Current, PackRange(Begin + 1, End), std::memory_order_acq_rel)) {
+            aChunk = static_cast<std::uint32_t>(Begin);
+            return true;
+        }
+    }
+}
+//---
+bool cParallelSimulator::Steal( int aThief ) {
+    const int NumWorkers = static_cast<int>(mQueues.size());
+    for (int Offset = 1; Offset < NumWorkers; ++Offset) {
+        std::atomic<std::uint64_t>& Victim = mQueues[(aThief + Offset) % NumWorkers].mRange;
+        std::uint64_t Current = Victim.load(std::memory_order_acquire);
+        for (;;) {
+            const std::uint64_t Begin = Current >> 32, End = Current & LowHalf;
+            if (Begin >= End)
+                break; // Nothing left here, try the next worker
+            const std::uint64_t Split = End - (End - Begin + 1) / 2; // Thief takes the back half, rounding up
+            if (Victim.compare_exchange_weak(Current, PackRange(Begin, Split), std::memory_order_acq_rel)) {
+                mQueues[aThief].mRange.store(PackRange(Split, End), std::memory_order_release);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+//---
+void cParallelSimulator::Execute( size_t aNumBlocks, const std::function<void( int aWorker, size_t aFirstBlock, size_t aEndBlock )>& aBody ) {
+    const size_t NumChunks = (aNumBlocks + mChunkBlocks - 1) / mChunkBlocks;
+    const int NumWorkers = GetNumThreads();
+
+    // Equal contiguous slices to start with, so neighbouring blocks stay on one worker
+    for (int w = 0; w < NumWorkers; ++w)
+        mQueues[w].mRange.store(PackRange(NumChunks * w / NumWorkers, NumChunks * (w + 1) / NumWorkers), std::memory_order_relaxed);
+
+    mPool.Run([&]( int aWorker ) {
+        cWorkerStats Stats{ 0, 0, 0 }; // Kept local so workers never share a cache line while running
+        for (;;) {
+            std::uint32_t Chunk;
+            if (!PopChunk(aWorker, Chunk)) {
+                if (!Steal(aWorker))
+                    break; // Every queue looked empty
+                ++Stats.mSteals;
+                continue;
+            }
+            const size_t First = size_t(Chunk) * mChunkBlocks;
+            const size_t End = std::min(First + mChunkBlocks, aNumBlocks);
+            aBody(aWorker, First, End);
+            ++Stats.mChunks;
+            Stats.mBlocks += static_cast<long long>(End - First);
+        }
+        mStats[aWorker] = Stats;
+    });
+}
+//---
+void cParallelSimulator::Run( const cNetlist& aNetlist, const cLogic::tPackedLevel* apInputs, cLogic::tPackedLevel* apOutputs, size_t aNumBlocks ) {
+    const int NumInputs = aNetlist.GetNumInputs(), NumOutputs = aNetlist.GetNumOutputs();
+    std::vector<std::vector<cLogic::tPackedLevel>> Nets(GetNumThreads()); // Per-worker scratch
+
+    Execute(aNumBlocks, [&]( int aWorker, size_t aFirst, size_t aEnd ) {
+        for (size_t b = aFirst; b < aEnd; ++b)
+            aNetlist.EvaluatePacked(apInputs + b * NumInputs, apOutputs + b * NumOutputs, Nets[aWorker]);
+    });
+}
+//---
+void cParallelSimulator::Run( const tCircuitFactory& aFactory, const cLogic::tPackedLevel* apInputs, cLogic::tPackedLevel* apOutputs, size_t aNumBlocks ) {
+    std::vector<std::unique_ptr<cLogicGate>> Circuits(GetNumThreads()); // Built by the worker that uses it
+
+    Execute(aNumBlocks, [&]( int aWorker, size_t aFirst, size_t aEnd ) {
+        if (!Circuits[aWorker])
+            Circuits[aWorker] = aFactory();
+        cLogicGate& Circuit = *Circuits[aWorker];
+        for (size_t b = aFirst; b < aEnd; ++b)
+            Circuit.ComputePacked(apInputs + b * Circuit.GetNumInputs(), apOutputs + b * Circuit.GetNumOutputs());
+    });
+}
+//---
+void cParallelSimulator::RunExhaustive( const cNetlist& aNetlist, std::vector<cLogic::tPackedLevel>& aOutputs ) {
+    const int NumInputs = aNetlist.GetNumInputs(), NumOutputs = aNetlist.GetNumOutputs();
+    const size_t NumBlocks = GetExhaustiveBlocks(NumInputs);
+    aOutputs.resize(NumBlocks * NumOutputs);
+    std::vector<std::vector<cLogic::tPackedLevel>> Nets(GetNumThreads()), Inputs(GetNumThreads());
+
+    Execute(NumBlocks, [&]( int aWorker, size_t aFirst, size_t aEnd ) {
+        Inputs[aWorker].resize(NumInputs);
+        for (size_t b = aFirst; b < aEnd; ++b) {
+            MakeExhaustiveBlock(NumInputs, b, Inputs[aWorker].data());
+            aNetlist.EvaluatePacked(Inputs[aWorker].data(), aOutputs.data() + b * NumOutputs, Nets[aWorker]);
+        }
+    });
+}
+//---
+void cParallelSimulator::RunExhaustive( const tCircuitFactory& aFactory, std::vector<cLogic::tPackedLevel>& aOutputs ) {
+    std::unique_ptr<cLogicGate> pShape = aFactory(); // Only for the input and output counts
+    const int NumInputs = pShape->GetNumInputs(), NumOutputs = pShape->GetNumOutputs();
+    const size_t NumBlocks = GetExhaustiveBlocks(NumInputs);
+    aOutputs.resize(NumBlocks * NumOutputs);
+    std::vector<std::unique_ptr<cLogicGate>> Circuits(GetNumThreads());
+    std::vector<std::vector<cLogic::tPackedLevel>> Inputs(GetNumThreads());
+    Circuits[0] = std::move(pShape);
+
+    Execute(NumBlocks, [&]( int aWorker, size_t aFirst, size_t aEnd ) {
+        if (!Circuits[aWorker])
+            Circuits[aWorker] = aFactory();
+        Inputs[aWorker].resize(NumInputs);
+        for (size_t b = aFirst; b < aEnd; ++b) {
+            MakeExhaustiveBlock(NumInputs, b, Inputs[aWorker].data());
+            Circuits[aWorker]->ComputePacked(Inputs[aWorker].data(), aOutputs.data() + b * NumOutputs);
+        }
+    });
+}
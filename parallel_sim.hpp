@@ -0,0 +1,80 @@
+// File: parallel_sim.hpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Header file for cParallelSimulator, stimulus-parallel simulation with work stealing.
+
+#ifndef PARALLEL_SIM_HPP
+#define PARALLEL_SIM_HPP
+
+#include "logic_gates.hpp"
+#include "netlist.hpp"
+#include "thread_pool.hpp"
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+// cParallelSimulator spreads independent stimulus vectors over a thread pool.
+// Stimulus is handled in blocks of 64 vectors (one tPackedLevel per signal), and blocks are
+// grouped into chunks. Each worker starts with an equal slice of the chunks and, when its
+// slice runs out, steals half of the remaining slice of another worker. Every block's
+// outputs are written to the block's own slot, so results are identical whichever
+// thread ran them.
+//
+// A compiled cNetlist is shared read-only by all workers. An object-model circuit is not
+// thread-safe, so each worker builds a private instance from a factory and evaluates it
+// through ComputePacked.
+class cParallelSimulator {
+    public:
+        typedef std::function<std::unique_ptr<cLogicGate>()> tCircuitFactory;
+
+        // cWorkerStats: Load-balancing counters of one worker for the last run
+        class cWorkerStats {
+            public:
+                long long mBlocks;  // Blocks of 64 vectors simulated
+                long long mChunks;  // Chunks simulated
+                long long mSteals;  // Successful steals from other workers
+        };
+
+        explicit cParallelSimulator( int aNumThreads = 0 ); // 0 uses every hardware thread
+        ~cParallelSimulator() {}
+
+        void SetChunkBlocks( int aBlocks ) { mChunkBlocks = aBlocks > 0 ? aBlocks : 1; } // Blocks per unit of work
+        int GetChunkBlocks() const { return mChunkBlocks; }
+        int GetNumThreads() const { return mPool.GetNumThreads(); }
+        const std::vector<cWorkerStats>& GetStats() const { return mStats; }
+
+        // Block-major stimulus: block b reads NumInputs words at apInputs + b*NumInputs
+        // and writes NumOutputs words at apOutputs + b*NumOutputs
+        void Run( const cNetlist& aNetlist, const cLogic::tPackedLevel* apInputs, cLogic::tPackedLevel* apOutputs, size_t aNumBlocks );
+        void Run( const tCircuitFactory& aFactory, const cLogic::tPackedLevel* apInputs, cLogic::tPackedLevel* apOutputs, size_t aNumBlocks );
+
+        // Every input combination, generated on the fly: vector v is lane v%64 of block v/64.
+        // aOutputs is resized to GetExhaustiveBlocks(NumInputs) blocks of NumOutputs words.
+        void RunExhaustive( const cNetlist& aNetlist, std::vector<cLogic::tPackedLevel>& aOutputs );
+        void RunExhaustive( const tCircuitFactory& aFactory, std::vector<cLogic::tPackedLevel>& aOutputs );
+
+        static size_t GetExhaustiveBlocks( int aNumInputs ); // Blocks covering 2^aNumInputs vectors (lanes repeat below 64)
+        static void MakeExhaustiveBlock( int aNumInputs, size_t aBlock, cLogic::tPackedLevel* apInputs ); // Input words of one block
+
+    private:
+        // cChunkQueue: One worker's remaining chunks [begin, end), packed as begin<<32 | end so the
+        // owner (taking from the front) and thieves (taking from the back) agree through one CAS
+        class alignas(64) cChunkQueue {
+            public:
+                std::atomic<std::uint64_t> mRange;
+        };
+
+        // Runs aBody(worker, firstBlock, endBlock) over every chunk of aNumBlocks blocks
+        void Execute( size_t aNumBlocks, const std::function<void( int aWorker, size_t aFirstBlock, size_t aEndBlock )>& aBody );
+        bool PopChunk( int aWorker, std::uint32_t& aChunk ); // Takes the next chunk of aWorker's own queue
+        bool Steal( int aThief ); // Moves half of another worker's chunks into aThief's queue
+
+        cThreadPool mPool;                       // Workers; the calling thread is worker 0
+        int mChunkBlocks;                        // See SetChunkBlocks
+        std::vector<cChunkQueue> mQueues;        // One per worker
+        std::vector<cWorkerStats> mStats;        // One per worker
+};
+
+#endif // PARALLEL_SIM_HPP
@@ -0,0 +1,324 @@
+// File: static_circuits.hpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Compile-time circuit descriptions for the fixed library cells (primitive gates,
+//              half/full adders and N-bit ripple adders), with constexpr truth tables,
+//              static_assert-checked behaviour and a cLogicGate adapter.
+
+#ifndef STATIC_CIRCUITS_HPP
+#define STATIC_CIRCUITS_HPP
+
+#include "logic_gates.hpp"
+#include "netlist.hpp"
+#include <array>
+#include <cstdint>
+
+//---Primitive operations-------------------------------------------------------
+// A static cell describes its wiring once as a constexpr function template over a word type.
+// With std::uint64_t each bit is an independent vector, which is what the truth tables and
+// ComputePacked use. With cStaticNet the same description flattens into a netlist instead:
+// the overloads below are exact matches, so they are chosen over the templates.
+
+template<class tWord> constexpr tWord StaticAnd( tWord aA, tWord aB ) { return aA & aB; }
+template<class tWord> constexpr tWord StaticOr( tWord aA, tWord aB ) { return aA | aB; }
+template<class tWord> constexpr tWord StaticXor( tWord aA, tWord aB ) { return aA ^ aB; }
+template<class tWord> constexpr tWord StaticNand( tWord aA, tWord aB ) { return ~(aA & aB); }
+template<class tWord> constexpr tWord StaticNor( tWord aA, tWord aB ) { return ~(aA | aB); }
+template<class tWord> constexpr tWord StaticXnor( tWord aA, tWord aB ) { return ~(aA ^ aB); }
+template<class tWord> constexpr tWord StaticNot( tWord aA ) { return ~aA; }
+template<class tWord> constexpr tWord StaticBuf( tWord aA ) { return aA; }
+
+// cStaticNet: A net of a netlist being built, as the word type of a flattening evaluation
+class cStaticNet {
+    public:
+        cNetlist* mpNetlist; // Netlist the gates are added to
+        int mNet;            // Net carrying this signal
+};
+
+inline cStaticNet StaticEmit( cNetlist::eOpcode aOpcode, cStaticNet aA, int aB = -1 ) {
+    return cStaticNet{ aA.mpNetlist, aA.mpNetlist->AddGate(aOpcode, aA.mNet, aB) };
+}
+inline cStaticNet StaticAnd( cStaticNet aA, cStaticNet aB ) { return StaticEmit(cNetlist::OP_AND, aA, aB.mNet); }
+inline cStaticNet StaticOr( cStaticNet aA, cStaticNet aB ) { return StaticEmit(cNetlist::OP_OR, aA, aB.mNet); }
+inline cStaticNet StaticXor( cStaticNet aA, cStaticNet aB ) { return StaticEmit(cNetlist::OP_XOR, aA, aB.mNet); }
+inline cStaticNet StaticNand( cStaticNet aA, cStaticNet aB ) { return StaticEmit(cNetlist::OP_NAND, aA, aB.mNet); }
+inline cStaticNet StaticNor( cStaticNet aA, cStaticNet aB ) { return StaticEmit(cNetlist::OP_NOR, aA, aB.mNet); }
+inline cStaticNet StaticXnor( cStaticNet aA, cStaticNet aB ) { return StaticEmit(cNetlist::OP_XNOR, aA, aB.mNet); }
+inline cStaticNet StaticNot( cStaticNet aA ) { return StaticEmit(cNetlist::OP_NOT, aA); }
+inline cStaticNet StaticBuf( cStaticNet aA ) { return StaticEmit(cNetlist::OP_BUF, aA); }
+
+
+//---Static cells---------------------------------------------------------------
+// Each cell has NumInputs, NumOutputs and Evaluate(inputs, outputs), with the same pin order
+// as its runtime counterpart (cAndGate, cHalfAdder, ..., cRippleCarryAdder<N>).
+
+class cStaticAndCell {
+    public:
+        static constexpr int NumInputs = 2, NumOutputs = 1;
+        template<class tWord> static constexpr void Evaluate( const tWord* apIn, tWord* apOut ) { apOut[0] = StaticAnd(apIn[0], apIn[1]); }
+};
+class cStaticOrCell {
+    public:
+        static constexpr int NumInputs = 2, NumOutputs = 1;
+        template<class tWord> static constexpr void Evaluate( const tWord* apIn, tWord* apOut ) { apOut[0] = StaticOr(apIn[0], apIn[1]); }
+};
+class cStaticXorCell {
+    public:
+        static constexpr int NumInputs = 2, NumOutputs = 1;
+        template<class tWord> static constexpr void Evaluate( const tWord* apIn, tWord* apOut ) { apOut[0] = StaticXor(apIn[0], apIn[1]); }
+};
+class cStaticNandCell {
+    public:
+        static constexpr int NumInputs = 2, NumOutputs = 1;
+        template<class tWord> static constexpr void Evaluate( const tWord* apIn, tWord* apOut ) { apOut[0] = StaticNand(apIn[0], apIn[1]); }
+};
+class cStaticNorCell {
+    public:
+        static constexpr int NumInputs = 2, NumOutputs = 1;
+        template<class tWord> static constexpr void Evaluate( const tWord* apIn, tWord* apOut ) { apOut[0] = StaticNor(apIn[0], apIn[1]); }
+};
+class cStaticXnorCell {
+    public:
+        static constexpr int NumInputs = 2, NumOutputs = 1;
+        template<class tWord> static constexpr void Evaluate( const tWord* apIn, tWord* apOut ) { apOut[0] = StaticXnor(apIn[0], apIn[1]); }
+};
+class cStaticNotCell {
+    public:
+        static constexpr int NumInputs = 1, NumOutputs = 1;
+        template<class tWord> static constexpr void Evaluate( const tWord* apIn, tWord* apOut ) { apOut[0] = StaticNot(apIn[0]); }
+};
+class cStaticBufCell {
+    public:
+        static constexpr int NumInputs = 1, NumOutputs = 1;
+        template<class tWord> static constexpr void Evaluate( const tWord* apIn, tWord* apOut ) { apOut[0] = StaticBuf(apIn[0]); }
+};
+
+// Inputs A, B; outputs Sum, Carry
+class cStaticHalfAdderCell {
+    public:
+        static constexpr int NumInputs = 2, NumOutputs = 2;
+        template<class tWord> static constexpr void Evaluate( const tWord* apIn, tWord* apOut ) {
+            apOut[0] = StaticXor(apIn[0], apIn[1]);
+            apOut[1] = StaticAnd(apIn[0], apIn[1]);
+        }
+};
+
+// Inputs A, B, Cin; outputs Sum, Cout. Two half adders and an OR, wired as cFullAdder
+class cStaticFullAdderCell {
+    public:
+        static constexpr int NumInputs = 3, NumOutputs = 2;
+        template<class tWord> static constexpr void Evaluate( const tWord* apIn, tWord* apOut ) {
+            tWord First[2] = {};
+            cStaticHalfAdderCell::Evaluate(apIn, First);
+            const tWord SecondIn[2] = { First[0], apIn[2] };
+            tWord Second[2] = {};
+            cStaticHalfAdderCell::Evaluate(SecondIn, Second);
+            apOut[0] = Second[0];
+            apOut[1] = StaticOr(Second[1], First[1]);
+        }
+};
+
+// Inputs A0..A(N-1), B0..B(N-1); outputs S0..S(N-1), COUT: the cAdder layout, so
+// cStaticRippleAdderCell<3> is also cThreeBitAdder
+template<int N>
+class cStaticRippleAdderCell {
+    static_assert(N >= 1, "An adder needs at least one bit");
+
+    public:
+        static constexpr int NumInputs = 2 * N, NumOutputs = N + 1;
+        template<class tWord> static constexpr void Evaluate( const tWord* apIn, tWord* apOut ) {
+            const tWord HalfIn[2] = { apIn[0], apIn[N] };
+            tWord Stage[2] = {};
+            cStaticHalfAdderCell::Evaluate(HalfIn, Stage);
+            apOut[0] = Stage[0];
+            for (int Bit = 1; Bit < N; ++Bit) {
+                const tWord FullIn[3] = { apIn[Bit], apIn[N + Bit], Stage[1] };
+                cStaticFullAdderCell::Evaluate(FullIn, Stage);
+                apOut[Bit] = Stage[0];
+            }
+            apOut[N] = Stage[1];
+        }
+};
+
+
+//---cStaticTruthTable----------------------------------------------------------
+// Tabulates a cell while compiling. Row r drives input i with bit i of r, so with 64 rows per
+// word the first six inputs are the fixed patterns 0xAAAA..., 0xCCCC..., ... and one evaluation
+// of the cell fills a whole word of every output.
+template<class tCell>
+class cStaticTabulator {
+    public:
+        static constexpr int NumInputs = tCell::NumInputs;
+        static constexpr int NumOutputs = tCell::NumOutputs;
+        static constexpr int NumRows = 1 << NumInputs;
+        static constexpr int NumWords = (NumRows + 63) / 64;
+        typedef std::array<std::uint64_t, NumOutputs * NumWords> tTable;   // Word w of output o at [o * NumWords + w]
+        typedef std::array<std::uint32_t, NumOutputs> tSupport;            // Inputs each output depends on, one bit per input
+
+        static constexpr std::uint64_t GetPattern( int aInput, int aWord ) {
+            constexpr std::uint64_t Patterns[6] = { 0xAAAAAAAAAAAAAAAAull, 0xCCCCCCCCCCCCCCCCull, 0xF0F0F0F0F0F0F0F0ull,
+                                                    0xFF00FF00FF00FF00ull, 0xFFFF0000FFFF0000ull, 0xFFFFFFFF00000000ull };
+            return aInput < 6 ? Patterns[aInput] : ((aWord >> (aInput - 6)) & 1) ? ~std::uint64_t(0) : 0;
+        }
+
+        static constexpr tTable Tabulate() {
+            const std::uint64_t Mask = NumRows >= 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << (NumRows % 64)) - 1;
+            tTable Table{};
+            for (int w = 0; w < NumWords; ++w) {
+                std::uint64_t In[NumInputs] = {};
+                std::uint64_t Out[NumOutputs] = {};
+                for (int i = 0; i < NumInputs; ++i)
+                    In[i] = GetPattern(i, w);
+                tCell::Evaluate(In, Out);
+                for (int o = 0; o < NumOutputs; ++o)
+                    Table[o * NumWords + w] = Out[o] & Mask;
+            }
+            return Table;
+        }
+
+        // Output o depends on input i if flipping i changes it on some row
+        static constexpr tSupport FindSupport( const tTable& aTable ) {
+            tSupport Support{};
+            for (int o = 0; o < NumOutputs; ++o) {
+                for (int i = 0; i < NumInputs; ++i) {
+                    bool Depends = false;
+                    for (int w = 0; w < NumWords && !Depends; ++w) {
+                        const std::uint64_t Word = aTable[o * NumWords + w];
+                        if (i < 6) {
+                            const std::uint64_t Low = ~GetPattern(i, 0) & (NumRows >= 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << (NumRows % 64)) - 1);
+                            Depends = ((Word ^ (Word >> (1 << i))) & Low) != 0;
+                        }
+                        else {
+                            Depends = Word != aTable[o * NumWords + (w ^ (1 << (i - 6)))];
+                        }
+                    }
+                    if (Depends)
+                        Support[o] |= std::uint32_t(1) << i;
+                }
+            }
+            return Support;
+        }
+};
+
+template<class tCell>
+class cStaticTruthTable {
+    typedef cStaticTabulator<tCell> tTabulator;
+    static_assert(tCell::NumInputs >= 1 && tCell::NumInputs <= 16, "Only cells of up to 16 inputs are tabulated");
+    static_assert(tCell::NumOutputs <= 32, "Rows are returned as a 32-bit output mask");
+
+    public:
+        static constexpr int NumInputs = tTabulator::NumInputs;
+        static constexpr int NumOutputs = tTabulator::NumOutputs;
+        static constexpr int NumRows = tTabulator::NumRows;
+        static constexpr int NumWords = tTabulator::NumWords;
+
+        static constexpr typename tTabulator::tTable Table = tTabulator::Tabulate();
+        static constexpr typename tTabulator::tSupport Support = tTabulator::FindSupport(Table);
+
+        static constexpr bool Get( unsigned aRow, int aOutput ) { return (Table[aOutput * NumWords + aRow / 64] >> (aRow % 64)) & 1; }
+        static constexpr std::uint32_t GetRow( unsigned aRow ) { // Every output on one row, output o in bit o
+            std::uint32_t Outputs = 0;
+            for (int o = 0; o < NumOutputs; ++o)
+                Outputs |= std::uint32_t(Get(aRow, o)) << o;
+            return Outputs;
+        }
+        static constexpr std::uint32_t GetSupport( int aOutput ) { return Support[aOutput]; }
+};
+
+// Out-of-line definitions for ODR-uses such as taking Table by reference
+template<class tCell> constexpr typename cStaticTabulator<tCell>::tTable cStaticTruthTable<tCell>::Table;
+template<class tCell> constexpr typename cStaticTabulator<tCell>::tSupport cStaticTruthTable<tCell>::Support;
+
+
+//---Compile-time checks--------------------------------------------------------
+// True if every row of the cell's table is the sum of its operands: NumBits-bit operands
+// A and B (then a carry-in when aCarryIn), outputs S0..S(NumBits-1), COUT.
+template<class tCell>
+constexpr bool IsStaticAdder( int aNumBits, bool aCarryIn ) {
+    typedef cStaticTruthTable<tCell> tTable;
+    for (unsigned Row = 0; Row < static_cast<unsigned>(tTable::NumRows); ++Row) {
+        const unsigned Mask = (1u << aNumBits) - 1;
+        const unsigned Sum = (Row & Mask) + ((Row >> aNumBits) & Mask) + (aCarryIn ? (Row >> (2 * aNumBits)) & 1 : 0);
+        if (tTable::GetRow(Row) != Sum)
+            return false;
+    }
+    return true;
+}
+
+// Rows run A=0 B=0, A=1 B=0, A=0 B=1, A=1 B=1 from bit 0
+static_assert(cStaticTruthTable<cStaticAndCell>::Table[0] == 0x8, "AND truth table");
+static_assert(cStaticTruthTable<cStaticOrCell>::Table[0] == 0xE, "OR truth table");
+static_assert(cStaticTruthTable<cStaticXorCell>::Table[0] == 0x6, "XOR truth table");
+static_assert(cStaticTruthTable<cStaticNandCell>::Table[0] == 0x7, "NAND truth table");
+static_assert(cStaticTruthTable<cStaticNorCell>::Table[0] == 0x1, "NOR truth table");
+static_assert(cStaticTruthTable<cStaticXnorCell>::Table[0] == 0x9, "XNOR truth table");
+static_assert(cStaticTruthTable<cStaticNotCell>::Table[0] == 0x1, "NOT truth table");
+static_assert(cStaticTruthTable<cStaticBufCell>::Table[0] == 0x2, "Buffer truth table");
+static_assert(IsStaticAdder<cStaticHalfAdderCell>(1, false), "Half adder must add two bits");
+static_assert(IsStaticAdder<cStaticFullAdderCell>(1, true), "Full adder must add three bits");
+static_assert(IsStaticAdder<cStaticRippleAdderCell<3>>(3, false), "Three-bit adder must add");
+static_assert(IsStaticAdder<cStaticRippleAdderCell<6>>(6, false), "Six-bit adder must add");
+static_assert(cStaticTruthTable<cStaticRippleAdderCell<3>>::GetSupport(0) == 0x09, "S0 depends only on A0 and B0");
+
+
+//---cStaticGate----------------------------------------------------------------
+// Runs a static cell as an ordinary gate. Scalar evaluation is a lookup in the compile-time
+// table: an output is undefined when an input it depends on is undefined, as a chain of the
+// primitive gates would report. Cells too wide to tabulate evaluate one lane instead and, not
+// knowing their support, make every output undefined on any undefined input. Packed
+// evaluation is the cell's Evaluate, inlined, and flattening replays the same description
+// onto cStaticNet.
+template<class tCell>
+class cStaticGate : public cLogicGate {
+    public:
+        cStaticGate() : cLogicGate(tCell::NumInputs, tCell::NumOutputs) { ComputeOutput(); }
+        virtual ~cStaticGate() {}
+
+        void ComputeOutput() override {
+            if constexpr (tCell::NumInputs <= 16) {
+                typedef cStaticTruthTable<tCell> tTable;
+                unsigned Row = 0;
+                std::uint32_t Undefined = 0;
+                for (int i = 0; i < tCell::NumInputs; ++i) {
+                    Row |= unsigned(mInputs[i] == cLogic::LOGIC_HIGH) << i;
+                    Undefined |= std::uint32_t(mInputs[i] == cLogic::LOGIC_UNDEFINED) << i;
+                }
+                const std::uint32_t Outputs = tTable::GetRow(Row);
+                for (int o = 0; o < tCell::NumOutputs; ++o) {
+                    SetOutput(o, (tTable::GetSupport(o) & Undefined) ? cLogic::LOGIC_UNDEFINED
+                               : ((Outputs >> o) & 1) ? cLogic::LOGIC_HIGH : cLogic::LOGIC_LOW);
+                }
+            }
+            else {
+                cLogic::tPackedLevel In[tCell::NumInputs];
+                cLogic::tPackedLevel Out[tCell::NumOutputs];
+                bool Undefined = false;
+                for (int i = 0; i < tCell::NumInputs; ++i) {
+                    In[i] = mInputs[i] == cLogic::LOGIC_HIGH;
+                    Undefined = Undefined || mInputs[i] == cLogic::LOGIC_UNDEFINED;
+                }
+                tCell::Evaluate(In, Out);
+                for (int o = 0; o < tCell::NumOutputs; ++o) {
+                    SetOutput(o, Undefined ? cLogic::LOGIC_UNDEFINED
+                               : (Out[o] & 1) ? cLogic::LOGIC_HIGH : cLogic::LOGIC_LOW);
+                }
+            }
+        }
+
+        void ComputePacked( const cLogic::tPackedLevel* apInputs, cLogic::tPackedLevel* apOutputs ) override {
+            tCell::Evaluate(apInputs, apOutputs);
+        }
+
+        bool Flatten( cNetlist& aNetlist, const int* apInputNets, int* apOutputNets ) const override {
+            cStaticNet In[tCell::NumInputs];
+            cStaticNet Out[tCell::NumOutputs];
+            for (int i = 0; i < tCell::NumInputs; ++i)
+                In[i] = cStaticNet{ &aNetlist, apInputNets[i] };
+            tCell::Evaluate(In, Out);
+            for (int o = 0; o < tCell::NumOutputs; ++o)
+                apOutputNets[o] = Out[o].mNet;
+            return true;
+        }
+};
+
+#endif // STATIC_CIRCUITS_HPP
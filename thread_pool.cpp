@@ -0,0 +1,77 @@
+// File: thread_pool.cpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Implementation file for cThreadPool.
+
+//--Includes-------------------------------------------------------------------
+#include "thread_pool.hpp"
+
+//---cThreadPool Implementation------------------------------------------------
+cThreadPool::cThreadPool( int aNumThreads )
+    : mpTask(nullptr),
+      mRunId(0),
+      mRunning(0),
+      mStop(false) {
+
+    const int NumThreads = aNumThreads > 0 ? aNumThreads : GetHardwareThreads();
+    mWorkers.reserve(NumThreads - 1);
+    for (int t = 1; t < NumThreads; ++t)
+        mWorkers.emplace_back(&cThreadPool::WorkerLoop, this, t);
+}
+//---
+cThreadPool::~cThreadPool() {
+    {
+        std::lock_guard<std::mutex> Lock(mMutex);
+        mStop = true;
+    }
+    mWake.notify_all();
+    for (std::thread& Worker : mWorkers)
+        Worker.join();
+}
+//---
+int cThreadPool::GetHardwareThreads() {
+    const unsigned Count = std::thread::hardware_concurrency();
+    return Count > 0 ? static_cast<int>(Count) : 1;
+}
+//---
+void cThreadPool::Run( const std::function<void( int aThread )>& aTask ) {
+    if (mWorkers.empty()) {
+        aTask(0); // Serial pool: nothing to hand out
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> Lock(mMutex);
+        mpTask = &aTask;
+        mRunning = static_cast<int>(mWorkers.size());
+        ++mRunId;
+    }
+    mWake.notify_all();
+
+    aTask(0);
+
+    std::unique_lock<std::mutex> Lock(mMutex);
+    mFinished.wait(Lock, [this] { return mRunning == 0; });
+    mpTask = nullptr;
+}
+//---
+void cThreadPool::WorkerLoop( int aThread ) {
+    unsigned SeenRun = 0;
+    for (;;) {
+        const std::function<void( int )>* pTask = nullptr;
+        {
+            std::unique_lock<std::mutex> Lock(mMutex);
+            mWake.wait(Lock, [&] { return mStop || mRunId != SeenRun; });
+            if (mStop)
+                return;
+            SeenRun = mRunId;
+            pTask = mpTask;
+        }
+
+        (*pTask)(aThread);
+
+        std::lock_guard<std::mutex> Lock(mMutex);
+        if (--mRunning == 0)
+            mFinished.notify_one();
+    }
+}
@@ -0,0 +1,43 @@
+// File: thread_pool.hpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Header file for cThreadPool, a fixed set of worker threads for the parallel engines.
+
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// cThreadPool keeps NumThreads-1 worker threads parked between runs. Run executes one task
+// on every participant at once (the calling thread is participant 0) and returns when all
+// have finished, so a one-thread pool runs everything inline with no synchronisation.
+class cThreadPool {
+    public:
+        explicit cThreadPool( int aNumThreads = 0 ); // 0 uses every hardware thread
+        ~cThreadPool(); // Stops and joins the workers
+        cThreadPool( const cThreadPool& ) = delete;
+        cThreadPool& operator=( const cThreadPool& ) = delete;
+
+        void Run( const std::function<void( int aThread )>& aTask ); // Calls aTask(t) for every t in [0, NumThreads) concurrently
+        int GetNumThreads() const { return static_cast<int>(mWorkers.size()) + 1; }
+
+        static int GetHardwareThreads(); // At least 1
+
+    private:
+        void WorkerLoop( int aThread ); // Body of each worker thread
+
+        std::vector<std::thread> mWorkers;                  // Participants 1..NumThreads-1
+        std::mutex mMutex;                                  // Guards everything below
+        std::condition_variable mWake;                      // Signals a new task or shutdown
+        std::condition_variable mFinished;                  // Signals the last worker finishing
+        const std::function<void( int )>* mpTask;           // Task of the current run
+        unsigned mRunId;                                    // Incremented for every run
+        int mRunning;                                       // Workers still inside the current task
+        bool mStop;                                         // Workers should exit
+};
+
+#endif // THREAD_POOL_HPP
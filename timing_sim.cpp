@@ -0,0 +1,277 @@
+// File: timing_sim.cpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Implementation file for cTimingSimulator.
+
+//--Includes-------------------------------------------------------------------
+#include "timing_sim.hpp"
+#include <algorithm>
+
+//---Local helpers-------------------------------------------------------------
+namespace {
+
+bool EvaluateOpcode( cNetlist::eOpcode aOpcode, bool aA, bool aB ) {
+    switch (aOpcode) {
+        case cNetlist::OP_AND:    return aA && aB;
+        case cNetlist::OP_OR:     return aA || aB;
+        case cNetlist::OP_XOR:    return aA != aB;
+        case cNetlist::OP_NAND:   return !(aA && aB);
+        case cNetlist::OP_NOR:    return !(aA || aB);
+        case cNetlist::OP_XNOR:   return aA == aB;
+        case cNetlist::OP_NOT:    return !aA;
+        case cNetlist::OP_BUF:    return aA;
+        case cNetlist::OP_CONST0: return false;
+        case cNetlist::OP_CONST1: return true;
+    }
+    return false;
+}
+
+} // namespace
+
+
+//---cTimingSimulator Implementation-------------------------------------------
+const int cTimingSimulator::MaxDelay;
+//---
+cTimingSimulator::cTimingSimulator( const cNetlist& aNetlist )
+    : mNetlist(aNetlist),
+      mRound(1), // Every mMarks entry starts at 0, an older round
+      mWheelMask(0),
+      mNumPending(0),
+      mTime(0),
+      mVectorStart(0),
+      mLast(),
+      mNumVectors(0),
+      mNumEvents(0),
+      mNumEvaluations(0),
+      mNumGlitches(0),
+      mNumFilteredPulses(0),
+      mMaxSettleTime(0) {
+
+    const int NumNets = mNetlist.GetNumNets();
+    const int NumGates = mNetlist.GetNumGates();
+
+    // CSR fanout; a gate reading the same net twice is listed once
+    mFanoutStart.assign(NumNets + 1, 0);
+    for (int g = 0; g < NumGates; ++g) {
+        const int A = mNetlist.GetInputA(g);
+        const int B = mNetlist.GetInputB(g);
+        if (A >= 0)
+            ++mFanoutStart[A + 1];
+        if (B >= 0 && B != A)
+            ++mFanoutStart[B + 1];
+    }
+    for (int n = 0; n < NumNets; ++n)
+        mFanoutStart[n + 1] += mFanoutStart[n];
+    mFanout.resize(mFanoutStart[NumNets]);
+    std::vector<int> Fill(mFanoutStart.begin(), mFanoutStart.end() - 1);
+    for (int g = 0; g < NumGates; ++g) {
+        const int A = mNetlist.GetInputA(g);
+        const int B = mNetlist.GetInputB(g);
+        if (A >= 0)
+            mFanout[Fill[A]++] = g;
+        if (B >= 0 && B != A)
+            mFanout[Fill[B]++] = g;
+    }
+
+    mDriver.assign(NumNets, -1);
+    mDelays.resize(NumGates);
+    for (int g = 0; g < NumGates; ++g) {
+        mDriver[mNetlist.GetOutputNet(g)] = g;
+        const int Delay = mNetlist.GetDelay(g);
+        mDelays[g] = static_cast<std::uint16_t>(Delay > 0 ? std::min(Delay, MaxDelay) : GetDefaultDelay(mNetlist.GetOpcode(g)));
+    }
+
+    mValues.assign(NumNets, 0);
+    mChangeTimes.assign(NumNets, 0);
+    mCauses.assign(NumNets, -1);
+    mChangeVector.assign(NumNets, -1);
+    mVectorChanges.assign(NumNets, 0);
+    mPending.assign(NumGates, 0);
+    mPendingValues.assign(NumGates, 0);
+    mPendingCauses.assign(NumGates, -1);
+    mSequences.assign(NumGates, 0);
+    mMarks.assign(NumGates, 0);
+    mMarked.reserve(NumGates);
+    SizeWheel();
+
+    std::vector<cLogic::eLogicLevel> Low(mNetlist.GetNumInputs(), cLogic::LOGIC_LOW);
+    Initialize(Low.data());
+}
+//---
+int cTimingSimulator::GetDefaultDelay( cNetlist::eOpcode aOpcode ) {
+    // Relative delays of a typical CMOS library: inverting gates are fastest, XOR slowest
+    switch (aOpcode) {
+        case cNetlist::OP_NOT:    return 1;
+        case cNetlist::OP_BUF:    return 2;
+        case cNetlist::OP_NAND:
+        case cNetlist::OP_NOR:    return 2;
+        case cNetlist::OP_AND:
+        case cNetlist::OP_OR:     return 3;
+        case cNetlist::OP_XOR:
+        case cNetlist::OP_XNOR:   return 4;
+        default:                  return 1; // Constants never change after Initialize
+    }
+}
+//---
+void cTimingSimulator::SetDelay( int aGate, int aDelay ) {
+    mDelays[aGate] = static_cast<std::uint16_t>(std::min(std::max(aDelay, 1), MaxDelay));
+    SizeWheel();
+}
+//---
+void cTimingSimulator::SizeWheel() {
+    int Longest = 1;
+    for (std::uint16_t Delay : mDelays)
+        Longest = std::max(Longest, static_cast<int>(Delay));
+
+    size_t Size = 2;
+    while (Size <= static_cast<size_t>(Longest))
+        Size *= 2;
+    if (Size > mWheel.size()) {
+        mWheel.resize(Size); // Empty between vectors, so nothing needs rehashing
+        mWheelMask = Size - 1;
+    }
+}
+//---
+void cTimingSimulator::Initialize( const cLogic::eLogicLevel* apInputs ) {
+    for (int i = 0; i < mNetlist.GetNumInputs(); ++i)
+        mValues[i] = apInputs[i] == cLogic::LOGIC_HIGH;
+
+    // Levelized order: every gate's inputs are final before it is evaluated
+    for (int g = 0; g < mNetlist.GetNumGates(); ++g) {
+        const int A = mNetlist.GetInputA(g);
+        const int B = mNetlist.GetInputB(g);
+        mValues[mNetlist.GetOutputNet(g)] = EvaluateOpcode(mNetlist.GetOpcode(g), A >= 0 && mValues[A], B >= 0 && mValues[B]);
+        mPending[g] = 0;
+        ++mSequences[g];
+    }
+
+    for (std::vector<cEvent>& Bucket : mWheel)
+        Bucket.clear();
+    mNumPending = 0;
+    std::fill(mChangeTimes.begin(), mChangeTimes.end(), mTime);
+    std::fill(mCauses.begin(), mCauses.end(), -1);
+}
+//---
+void cTimingSimulator::MarkFanout( int aNet ) {
+    for (int f = mFanoutStart[aNet]; f < mFanoutStart[aNet + 1]; ++f) {
+        const int Gate = mFanout[f];
+        if (mMarks[Gate] != mRound) {
+            mMarks[Gate] = mRound;
+            mMarked.push_back(Gate);
+        }
+    }
+}
+//---
+void cTimingSimulator::ChangeNet( int aNet, bool aValue, int aCause ) {
+    mValues[aNet] = aValue;
+    mChangeTimes[aNet] = mTime;
+    mCauses[aNet] = aCause;
+    if (mChangeVector[aNet] != mNumVectors) {
+        mChangeVector[aNet] = mNumVectors;
+        mVectorChanges[aNet] = 0;
+    }
+    ++mVectorChanges[aNet];
+    ++mLast.mEvents;
+    MarkFanout(aNet);
+}
+//---
+void cTimingSimulator::EvaluateMarked() {
+    mLast.mEvaluations += static_cast<long long>(mMarked.size());
+    for (int Gate : mMarked) {
+        const int A = mNetlist.GetInputA(Gate);
+        const int B = mNetlist.GetInputB(Gate);
+        const bool Value = EvaluateOpcode(mNetlist.GetOpcode(Gate), A >= 0 && mValues[A], B >= 0 && mValues[B]);
+
+        if (mPending[Gate]) {
+            if (Value == mPendingValues[Gate])
+                continue; // Already on its way to this value
+            // The inputs moved back before the output did: the pulse is shorter than the delay
+            ++mSequences[Gate];
+            mPending[Gate] = 0;
+            ++mLast.mFilteredPulses;
+        }
+        if (Value == mValues[mNetlist.GetOutputNet(Gate)])
+            continue;
+
+        // The input that changed now triggered this evaluation; A wins a tie
+        const int Cause = A >= 0 && mChangeTimes[A] == mTime ? A : B;
+        mPending[Gate] = 1;
+        mPendingValues[Gate] = Value;
+        mPendingCauses[Gate] = Cause;
+        mWheel[(mTime + mDelays[Gate]) & mWheelMask].push_back(cEvent{ Gate, mSequences[Gate] });
+        ++mNumPending;
+    }
+    mMarked.clear();
+    ++mRound;
+}
+//---
+const cTimingSimulator::cVectorStats& cTimingSimulator::ApplyVector( const cLogic::eLogicLevel* apInputs ) {
+    mLast = cVectorStats();
+    mLast.mCriticalOutput = -1;
+    mVectorStart = ++mTime; // After every change of the previous vector, so none is mistaken for a cause
+
+    for (int i = 0; i < mNetlist.GetNumInputs(); ++i) {
+        const bool Value = apInputs[i] == cLogic::LOGIC_HIGH;
+        if (Value != static_cast<bool>(mValues[i]))
+            ChangeNet(i, Value, -1);
+    }
+    EvaluateMarked();
+
+    // Every delay is shorter than the wheel, so the next event is at most MaxDelay buckets ahead
+    while (mNumPending > 0) {
+        std::vector<cEvent>* pBucket;
+        do
+            pBucket = &mWheel[++mTime & mWheelMask];
+        while (pBucket->empty());
+
+        // Changes at one time all land before any gate is evaluated, so simultaneous input changes do not glitch
+        for (const cEvent& Event : *pBucket) {
+            --mNumPending;
+            if (Event.mSequence != mSequences[Event.mGate])
+                continue; // Cancelled
+            mPending[Event.mGate] = 0;
+            ChangeNet(mNetlist.GetOutputNet(Event.mGate), mPendingValues[Event.mGate], mPendingCauses[Event.mGate]);
+        }
+        pBucket->clear();
+        EvaluateMarked();
+    }
+
+    // Outputs: settle time, critical output and hazards
+    for (int o = 0; o < mNetlist.GetNumOutputs(); ++o) {
+        const int Net = mNetlist.GetOutput(o);
+        if (mChangeVector[Net] != mNumVectors)
+            continue;
+        const int Changes = mVectorChanges[Net];
+        mLast.mOutputChanges += Changes;
+        mLast.mGlitches += Changes - (Changes & 1); // An odd count ends on the new value
+        if (mLast.mCriticalOutput < 0 || mChangeTimes[Net] - mVectorStart > mLast.mSettleTime) {
+            mLast.mSettleTime = mChangeTimes[Net] - mVectorStart;
+            mLast.mCriticalOutput = o;
+        }
+    }
+    mLast.mQuietTime = mTime - mVectorStart;
+
+    ++mNumVectors;
+    mNumEvents += mLast.mEvents;
+    mNumEvaluations += mLast.mEvaluations;
+    mNumGlitches += mLast.mGlitches;
+    mNumFilteredPulses += mLast.mFilteredPulses;
+    mMaxSettleTime = std::max(mMaxSettleTime, mLast.mSettleTime);
+    return mLast;
+}
+//---
+std::vector<int> cTimingSimulator::GetCriticalPath() const {
+    std::vector<int> Path;
+    if (mNumVectors == 0 || mLast.mCriticalOutput < 0)
+        return Path;
+
+    // Follow each change back to the input change that triggered it, within the last vector
+    const long long Vector = mNumVectors - 1;
+    int Net = mNetlist.GetOutput(mLast.mCriticalOutput);
+    while (Net >= 0 && mDriver[Net] >= 0 && mChangeVector[Net] == Vector) {
+        Path.push_back(mDriver[Net]);
+        Net = mCauses[Net];
+    }
+    std::reverse(Path.begin(), Path.end());
+    return Path;
+}
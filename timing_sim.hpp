@@ -0,0 +1,115 @@
+// File: timing_sim.hpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Header file for cTimingSimulator, event-driven timing simulation of a compiled
+//              netlist with per-gate propagation delays and inertial glitch filtering.
+
+#ifndef TIMING_SIM_HPP
+#define TIMING_SIM_HPP
+
+#include "netlist.hpp"
+#include <cstdint>
+#include <vector>
+
+// cTimingSimulator replays input vectors through a compiled (levelized) netlist with real gate
+// delays, so hazards and settle times show up that the zero-delay evaluators hide.
+// Delays come from the netlist (cLogicGate::SetDelay before Compile), can be overridden per
+// gate with SetDelay, and default by opcode. Pending output changes live on a timing wheel:
+// every delay is shorter than the wheel, so a bucket only ever holds events for one time,
+// insert is a push_back and finding the next event scans at most the longest delay.
+//
+// Gates have inertial delay: a pulse on a gate's inputs shorter than the gate's delay is
+// swallowed, the pending change being cancelled rather than reaching the output.
+// Simulation is two-valued; LOGIC_UNDEFINED inputs are treated as LOW.
+class cTimingSimulator {
+    public:
+        // cVectorStats: What one ApplyVector call did, times relative to the vector
+        class cVectorStats {
+            public:
+                long long mSettleTime;      // Last primary output change (0 if no output changed)
+                long long mQuietTime;       // Last change on any net
+                long long mEvents;          // Net changes
+                long long mEvaluations;     // Gate evaluations
+                int mOutputChanges;         // Primary output transitions
+                int mGlitches;              // Output transitions beyond those needed to reach the final values
+                int mFilteredPulses;        // Pending changes cancelled by inertial delay
+                int mCriticalOutput;        // Primary output that settled last (-1 if none changed)
+        };
+
+        explicit cTimingSimulator( const cNetlist& aNetlist ); // aNetlist must outlive the simulator and not change
+        cTimingSimulator( const cTimingSimulator& ) = delete;
+        cTimingSimulator& operator=( const cTimingSimulator& ) = delete;
+
+        static int GetDefaultDelay( cNetlist::eOpcode aOpcode ); // Delay used when the netlist gives none
+        void SetDelay( int aGate, int aDelay ); // Overrides one gate's delay (clamped to 1..MaxDelay); not during ApplyVector
+        int GetDelay( int aGate ) const { return mDelays[aGate]; }
+
+        void Initialize( const cLogic::eLogicLevel* apInputs ); // Settles every net for apInputs with no timing, as the state before the first vector
+        const cVectorStats& ApplyVector( const cLogic::eLogicLevel* apInputs ); // Changes the inputs one time unit after the last change and simulates until no events remain
+
+        cLogic::eLogicLevel GetOutput( int aOutputIndex ) const { return mValues[mNetlist.GetOutput(aOutputIndex)] ? cLogic::LOGIC_HIGH : cLogic::LOGIC_LOW; }
+        long long GetTime() const { return mTime; } // Current simulation time
+        const cVectorStats& GetLastStats() const { return mLast; }
+        std::vector<int> GetCriticalPath() const; // Gates whose changes led to the last vector's final critical output change, input side first
+
+        // Totals since construction
+        long long GetNumVectors() const { return mNumVectors; }
+        long long GetNumEvents() const { return mNumEvents; }
+        long long GetNumEvaluations() const { return mNumEvaluations; }
+        long long GetNumGlitches() const { return mNumGlitches; }
+        long long GetNumFilteredPulses() const { return mNumFilteredPulses; }
+        long long GetMaxSettleTime() const { return mMaxSettleTime; }
+
+        static const int MaxDelay = 1 << 12; // Longest delay a gate may have
+
+    private:
+        // cEvent: A gate output change waiting on the wheel; stale once the gate's sequence moves on
+        class cEvent {
+            public:
+                std::int32_t mGate;     // Gate whose output changes
+                std::uint32_t mSequence; // Gate's mSequences value when scheduled
+        };
+
+        void SizeWheel(); // Makes the wheel longer than the longest delay
+        void MarkFanout( int aNet ); // Queues the gates reading aNet for evaluation at the current time
+        void EvaluateMarked(); // Evaluates the queued gates, scheduling or cancelling their output changes
+        void ChangeNet( int aNet, bool aValue, int aCause ); // Applies a change to a net at the current time
+
+        const cNetlist& mNetlist;                   // Circuit being simulated
+        std::vector<int> mFanoutStart;              // Net n is read by gates mFanout[mFanoutStart[n] .. mFanoutStart[n+1])
+        std::vector<int> mFanout;
+        std::vector<int> mDriver;                   // Gate driving each net (-1 for primary inputs)
+        std::vector<std::uint16_t> mDelays;         // Delay of each gate
+
+        // Net state
+        std::vector<std::uint8_t> mValues;          // Current value of each net
+        std::vector<long long> mChangeTimes;        // Time of each net's last change
+        std::vector<int> mCauses;                   // Input net whose change caused each net's last change (-1: primary input)
+        std::vector<long long> mChangeVector;       // Vector during which each net last changed
+        std::vector<int> mVectorChanges;            // Changes of each net during that vector
+
+        // Gate state
+        std::vector<std::uint8_t> mPending;         // Gate has an output change on the wheel
+        std::vector<std::uint8_t> mPendingValues;   // Value that change will drive
+        std::vector<int> mPendingCauses;            // Input net that triggered it
+        std::vector<std::uint32_t> mSequences;      // Bumped to cancel a pending change
+        std::vector<std::uint64_t> mMarks;          // Evaluation round each gate was last queued in
+        std::vector<int> mMarked;                   // Gates queued for the current round
+        std::uint64_t mRound;                       // Evaluation rounds started, one per time with changes
+
+        std::vector<std::vector<cEvent>> mWheel;    // Bucket t & mWheelMask holds the events for time t
+        size_t mWheelMask;
+        long long mNumPending;                      // Events on the wheel, stale ones included
+        long long mTime;                            // Current simulation time
+        long long mVectorStart;                     // Time the current vector was applied
+
+        cVectorStats mLast;                         // See GetLastStats
+        long long mNumVectors;
+        long long mNumEvents;
+        long long mNumEvaluations;
+        long long mNumGlitches;
+        long long mNumFilteredPulses;
+        long long mMaxSettleTime;
+};
+
+#endif // TIMING_SIM_HPP
@@ -0,0 +1,181 @@
+// File: truth_table.cpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Implementation file for the truth-table (LUT) cache.
+
+//--Includes-------------------------------------------------------------------
+#include "truth_table.hpp"
+#include "netlist.hpp"
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+
+//---Local state---------------------------------------------------------------
+namespace {
+
+std::atomic<int> gThreshold(0);       // Largest input count cached, 0 when the cache is off
+std::atomic<unsigned> gGeneration(0); // Bumped on every configuration change
+std::mutex gMutex;                    // Guards the table map and gStats
+cTruthTableCache::sStats gStats = { 0, 0, 0, 0, 0 };
+
+// Tables keyed by the flattened structure of the circuits that use them
+std::map<std::string, std::unique_ptr<cTruthTable>>& GetTables() {
+  static std::map<std::string, std::unique_ptr<cTruthTable>> Tables;
+  return Tables;
+}
+
+// Serialises a compiled netlist so structurally identical circuits map to the same key
+std::string MakeKey( const cNetlist& aNetlist ) {
+  std::string Key;
+  auto Append = [&Key]( int aValue ) { Key.append(reinterpret_cast<const char*>(&aValue), sizeof(aValue)); };
+
+  Append(aNetlist.GetNumInputs());
+  Append(aNetlist.GetNumOutputs());
+  for( int g=0; g<aNetlist.GetNumGates(); ++g ) {
+    Append(aNetlist.GetOpcode(g));
+    Append(aNetlist.GetInputA(g));
+    Append(aNetlist.GetInputB(g));
+  }
+  for( int o=0; o<aNetlist.GetNumOutputs(); ++o )
+    Append(aNetlist.GetOutput(o));
+  return Key;
+}
+
+} // namespace
+
+
+//---cTruthTable Implementation------------------------------------------------
+cTruthTable::cTruthTable( int aNumInputs, int aNumOutputs )
+  : mNumInputs(aNumInputs), mNumOutputs(aNumOutputs), mLookups(0) {
+
+  size_t Size = 1;
+  for( int i=0; i<aNumInputs; ++i )
+    Size *= 3;
+  mEntries.assign(Size, 0);
+}
+//---
+std::uint32_t cTruthTable::Lookup( const cLogic::eLogicLevel* apInputs ) const {
+
+  // Base-3 index, most significant input first so the loop is a single multiply-add chain
+  size_t Index = 0;
+  for( int i=mNumInputs-1; i>=0; --i )
+    Index = Index * 3 + static_cast<size_t>(apInputs[i] + 1);
+
+  mLookups.fetch_add(1, std::memory_order_relaxed);
+  return mEntries[Index];
+}
+//---
+cLogic::eLogicLevel cTruthTable::Decode( std::uint32_t aEntry, int aOutputIndex ) {
+
+  const std::uint32_t Code = (aEntry >> (2 * aOutputIndex)) & 3;
+  return (Code == 2) ? cLogic::LOGIC_UNDEFINED : static_cast<cLogic::eLogicLevel>(Code);
+}
+//---
+std::uint32_t cTruthTable::Encode( const cLogic::eLogicLevel* apOutputs, int aNumOutputs ) {
+
+  std::uint32_t Entry = 0;
+  for( int o=0; o<aNumOutputs; ++o ) {
+    const std::uint32_t Code = (apOutputs[o] == cLogic::LOGIC_UNDEFINED) ? 2 : static_cast<std::uint32_t>(apOutputs[o]);
+    Entry |= Code << (2 * o);
+  }
+  return Entry;
+}
+
+
+//---cTruthTableCache Implementation-------------------------------------------
+void cTruthTableCache::SetThreshold( int aMaxInputs ) {
+
+  gThreshold.store((aMaxInputs > MaxInputs) ? MaxInputs : aMaxInputs);
+  ++gGeneration; // Every gate re-checks at its next evaluation, and then sees the new threshold
+}
+//---
+int cTruthTableCache::GetThreshold() {
+
+  return gThreshold.load();
+}
+//---
+unsigned cTruthTableCache::GetGeneration() {
+
+  return gGeneration.load();
+}
+//---
+void cTruthTableCache::Attach( cLogicGate& aGate ) {
+
+  // Generation before threshold, so a concurrent SetThreshold is picked up next evaluation
+  aGate.mTableGeneration = gGeneration.load();
+  aGate.mpTruthTable = nullptr;
+
+  const int Threshold = gThreshold.load();
+  if( Threshold > 0 && aGate.IsTruthTableCandidate()
+      && aGate.GetNumInputs() <= Threshold && aGate.GetNumOutputs() <= MaxOutputs ) {
+    std::lock_guard<std::mutex> Lock(gMutex);
+    aGate.mpTruthTable = FindOrBuild(aGate);
+  }
+}
+//---
+const cTruthTable* cTruthTableCache::FindOrBuild( const cLogicGate& aGate ) {
+
+  cNetlist Netlist;
+  if( !Netlist.Compile(aGate) )
+    return nullptr; // Only circuits that flatten can be tabulated
+
+  std::unique_ptr<cTruthTable>& pTable = GetTables()[MakeKey(Netlist)];
+  if( pTable )
+    return pTable.get();
+
+  // Simulate every three-valued input combination once through the compiled netlist
+  const std::chrono::steady_clock::time_point Start = std::chrono::steady_clock::now();
+  pTable.reset(new cTruthTable(aGate.GetNumInputs(), aGate.GetNumOutputs()));
+
+  std::vector<cLogic::eLogicLevel> Inputs(aGate.GetNumInputs(), cLogic::LOGIC_UNDEFINED);
+  std::vector<cLogic::eLogicLevel> Outputs(aGate.GetNumOutputs());
+  std::vector<cLogic::eLogicLevel> Nets;
+  std::vector<std::uint32_t>& Entries = pTable->GetEntries();
+  for( size_t Index=0; Index<Entries.size(); ++Index ) {
+    size_t Rest = Index;
+    for( int i=0; i<aGate.GetNumInputs(); ++i, Rest /= 3 )
+      Inputs[i] = static_cast<cLogic::eLogicLevel>(static_cast<int>(Rest % 3) - 1);
+
+    Netlist.Evaluate(Inputs.data(), Outputs.data(), Nets);
+    Entries[Index] = cTruthTable::Encode(Outputs.data(), aGate.GetNumOutputs());
+  }
+
+  ++gStats.mTablesBuilt;
+  gStats.mEntriesBuilt += static_cast<long long>(Entries.size());
+  gStats.mTableBytes += pTable->GetBytes();
+  gStats.mBuildNanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - Start).count();
+  return pTable.get();
+}
+//---
+cTruthTableCache::sStats cTruthTableCache::GetStats() {
+
+  std::lock_guard<std::mutex> Lock(gMutex);
+  sStats Stats = gStats;
+  Stats.mLookups = 0;
+  for( const auto& Table : GetTables() )
+    Stats.mLookups += Table.second->GetLookups();
+  return Stats;
+}
+//---
+void cTruthTableCache::PrintStats( std::ostream& aOut ) {
+
+  const sStats Stats = GetStats();
+  aOut << "Truth-table cache (threshold " << gThreshold.load() << " inputs)\n"
+       << "  tables built:   " << Stats.mTablesBuilt << " (" << Stats.mEntriesBuilt << " entries, "
+       << Stats.mTableBytes << " bytes)\n"
+       << "  build time:     " << Stats.mBuildNanoseconds / 1000 << " us\n"
+       << "  table lookups:  " << Stats.mLookups << "\n";
+  if( Stats.mLookups > 0 )
+    aOut << "  build cost per lookup: " << double(Stats.mBuildNanoseconds) / Stats.mLookups << " ns\n";
+}
+//---
+void cTruthTableCache::Clear() {
+
+  std::lock_guard<std::mutex> Lock(gMutex);
+  GetTables().clear();
+  gStats = sStats{ 0, 0, 0, 0, 0 };
+  ++gGeneration; // Gates must not keep pointers to the dropped tables
+}
@@ -0,0 +1,75 @@
+// File: truth_table.hpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Header file for the opt-in truth-table (LUT) cache for small subcircuits.
+
+#ifndef TRUTH_TABLE_HPP
+#define TRUTH_TABLE_HPP
+
+#include "logic_gates.hpp"
+#include <atomic>
+#include <cstdint>
+#include <iosfwd>
+#include <vector>
+
+// cTruthTable is the complete three-valued function of a small circuit.
+// Inputs index the table in base 3 (UNDEFINED=0, LOW=1, HIGH=2, input 0 least significant),
+// and each entry packs every output into 2 bits (LOW=0, HIGH=1, UNDEFINED=2).
+class cTruthTable {
+    public:
+        cTruthTable( int aNumInputs, int aNumOutputs ); // Allocates 3^aNumInputs entries
+
+        std::uint32_t Lookup( const cLogic::eLogicLevel* apInputs ) const; // Entry for one input vector, counted as a hit
+        static cLogic::eLogicLevel Decode( std::uint32_t aEntry, int aOutputIndex ); // One output of an entry
+        static std::uint32_t Encode( const cLogic::eLogicLevel* apOutputs, int aNumOutputs ); // Packs an output vector
+
+        int GetNumInputs() const { return mNumInputs; }
+        int GetNumOutputs() const { return mNumOutputs; }
+        size_t GetBytes() const { return mEntries.size() * sizeof(std::uint32_t); }
+        long long GetLookups() const { return mLookups.load(std::memory_order_relaxed); }
+        std::vector<std::uint32_t>& GetEntries() { return mEntries; }
+
+    private:
+        int mNumInputs;                       // Number of circuit inputs
+        int mNumOutputs;                      // Number of circuit outputs (at most 16)
+        std::vector<std::uint32_t> mEntries;  // One packed output vector per input combination
+        mutable std::atomic<long long> mLookups; // Evaluations answered from this table, from any thread
+};
+
+
+// cTruthTableCache decides which gates evaluate through a truth table and owns the tables.
+// It is off by default; SetThreshold(n) turns it on for subcircuits with at most n inputs.
+// Gates check the cache generation on evaluation, so changing the threshold takes effect at
+// their next evaluation. Circuits with identical flattened structure share one table.
+//
+// Gates may evaluate on several threads at once: table lookup and building are serialised
+// by one lock and the counters are atomic. SetThreshold may be called at any time, but
+// Clear frees the tables and must not run while any gate is evaluating.
+class cTruthTableCache {
+    public:
+        static const int MaxInputs = 12;  // 3^12 entries is the largest table built
+        static const int MaxOutputs = 16; // Outputs that fit in one 32-bit entry
+
+        // sStats: Counters for judging whether caching pays for itself
+        struct sStats {
+            long long mLookups;          // Evaluations answered from a table
+            long long mTablesBuilt;      // Distinct tables computed
+            long long mEntriesBuilt;     // Input combinations simulated to fill them
+            long long mBuildNanoseconds; // Time spent building tables
+            size_t mTableBytes;          // Memory held by all tables
+        };
+
+        static void SetThreshold( int aMaxInputs ); // Cache subcircuits with up to aMaxInputs inputs (0 disables)
+        static int GetThreshold();
+        static unsigned GetGeneration(); // Changes whenever the threshold changes
+
+        static void Attach( cLogicGate& aGate ); // Finds or builds a table for aGate under the current threshold
+        static sStats GetStats();
+        static void PrintStats( std::ostream& aOut );
+        static void Clear(); // Drops every table and resets the statistics
+
+    private:
+        static const cTruthTable* FindOrBuild( const cLogicGate& aGate ); // Table for aGate's structure, or nullptr; the caller holds the cache lock
+};
+
+#endif // TRUTH_TABLE_HPP
@@ -0,0 +1,299 @@
+// File: wave_trace.cpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Implementation file for cWaveTracer.
+
+//--Includes-------------------------------------------------------------------
+#include "wave_trace.hpp"
+#include <cassert>
+#include <chrono>
+#include <limits>
+
+//---Local helpers-------------------------------------------------------------
+namespace {
+
+const size_t WriteChunkBytes = 1 << 16; // Formatted text is written in chunks of about this size
+
+// Glob match with '*' (any run of characters) and '?' (any one character)
+bool Matches( const char* apPattern, const char* apText ) {
+    const char* pStar = nullptr;
+    const char* pResume = nullptr;
+    while (*apText != '\0') {
+        if (*apPattern == '*') {
+            pStar = apPattern++;
+            pResume = apText;
+        } else if (*apPattern == '?' || *apPattern == *apText) {
+            ++apPattern;
+            ++apText;
+        } else if (pStar != nullptr) {
+            apPattern = pStar + 1;
+            apText = ++pResume;
+        } else
+            return false;
+    }
+    while (*apPattern == '*')
+        ++apPattern;
+    return *apPattern == '\0';
+}
+
+std::uint64_t EncodeLevel( cLogic::eLogicLevel aLevel ) {
+    return aLevel == cLogic::LOGIC_LOW ? 0 : aLevel == cLogic::LOGIC_HIGH ? 1 : 2;
+}
+
+} // namespace
+
+
+//---cWaveTracer Implementation------------------------------------------------
+const size_t cWaveTracer::DefaultRingEntries;
+//---
+cWaveTracer::cWaveTracer( size_t aRingEntries )
+    : mWindowBegin(0),
+      mWindowEnd(std::numeric_limits<long long>::max()),
+      mTime(0),
+      mRecording(false),
+      mTimePushed(false),
+      mHead(0),
+      mTail(0),
+      mCachedTail(0),
+      mStop(false),
+      mNumChanges(0),
+      mNumStalls(0),
+      mpFile(nullptr),
+      mPendingTime(0),
+      mWrittenTime(-1) {
+
+    size_t Size = 2;
+    while (Size < aRingEntries)
+        Size *= 2;
+    mRing.assign(Size, 0);
+    mMask = Size - 1;
+}
+//---
+cWaveTracer::~cWaveTracer() {
+    Close();
+}
+//---
+void cWaveTracer::AddFilter( const std::string& aPattern ) {
+    mFilters.push_back(aPattern);
+}
+//---
+void cWaveTracer::SetWindow( long long aBegin, long long aEnd ) {
+    mWindowBegin = aBegin < 0 ? 0 : aBegin;
+    mWindowEnd = aEnd;
+}
+//---
+bool cWaveTracer::IsSelected( const std::string& aName ) const {
+    if (mFilters.empty())
+        return true;
+    for (const std::string& Filter : mFilters) {
+        if (Matches(Filter.c_str(), aName.c_str()))
+            return true;
+    }
+    return false;
+}
+//---
+int cWaveTracer::Attach( cLogicGate& aCircuit, const std::string& aName ) {
+    if (mpFile != nullptr)
+        return 0; // The header is already written
+    const int Before = GetNumSignals();
+    AttachGate(aCircuit, aName, true);
+    return GetNumSignals() - Before;
+}
+//---
+void cWaveTracer::AttachGate( cLogicGate& aGate, const std::string& aScope, bool aIsRoot ) {
+    if (aGate.mpTrace == nullptr) {
+        cTraceBinding Binding;
+        Binding.mpTracer = this;
+        Binding.mpGate = &aGate;
+        Binding.mInputs.assign(aIsRoot ? aGate.GetNumInputs() : 0, -1);
+        Binding.mOutputs.assign(aGate.GetNumOutputs(), -1);
+
+        // Only the root's inputs are traced: every other input is some gate's output
+        for (int i = 0; i < static_cast<int>(Binding.mInputs.size()); ++i) {
+            const std::string Name = "in" + std::to_string(i);
+            if (IsSelected(aScope + "." + Name)) {
+                Binding.mInputs[i] = GetNumSignals();
+                mSignals.push_back(cSignal{ aScope, Name, &aGate, i, true });
+            }
+        }
+        for (int o = 0; o < aGate.GetNumOutputs(); ++o) {
+            const std::string Name = "out" + std::to_string(o);
+            if (IsSelected(aScope + "." + Name)) {
+                Binding.mOutputs[o] = GetNumSignals();
+                mSignals.push_back(cSignal{ aScope, Name, &aGate, o, false });
+            }
+        }
+
+        mBindings.push_back(Binding);
+        aGate.mpTrace = &mBindings.back();
+    }
+
+    aGate.ForEachChild([this, &aScope]( cLogicGate& aChild, const std::string& aChildName ) {
+        AttachGate(aChild, aScope + "." + aChildName, false);
+    });
+}
+//---
+std::string cWaveTracer::GetIdCode( int aSignal ) const {
+    std::string Code;
+    do {
+        Code += static_cast<char>('!' + aSignal % 94); // Printable ASCII '!'..'~'
+        aSignal /= 94;
+    } while (aSignal > 0);
+    return Code;
+}
+//---
+bool cWaveTracer::Open( const char* apPath, const char* apTimescale ) {
+    CloseFile();
+    mpFile = std::fopen(apPath, "w");
+    if (mpFile == nullptr)
+        return false;
+
+    mIdCodes.clear();
+    for (int s = 0; s < GetNumSignals(); ++s)
+        mIdCodes.push_back(GetIdCode(s));
+
+    // Header: one $scope per dotted scope level, opened and closed as the signal list moves through them
+    std::string Header = "$version logic circuit simulator $end\n$timescale " + std::string(apTimescale) + " $end\n";
+    std::vector<std::string> OpenScopes;
+    for (int s = 0; s < GetNumSignals(); ++s) {
+        std::vector<std::string> Path;
+        size_t Start = 0;
+        for (size_t Dot; (Dot = mSignals[s].mScope.find('.', Start)) != std::string::npos; Start = Dot + 1)
+            Path.push_back(mSignals[s].mScope.substr(Start, Dot - Start));
+        Path.push_back(mSignals[s].mScope.substr(Start));
+
+        size_t Common = 0;
+        while (Common < OpenScopes.size() && Common < Path.size() && OpenScopes[Common] == Path[Common])
+            ++Common;
+        for (size_t Level = OpenScopes.size(); Level > Common; --Level)
+            Header += "$upscope $end\n";
+        for (size_t Level = Common; Level < Path.size(); ++Level)
+            Header += "$scope module " + Path[Level] + " $end\n";
+        OpenScopes = Path;
+
+        Header += "$var wire 1 " + mIdCodes[s] + " " + mSignals[s].mName + " $end\n";
+    }
+    for (size_t Level = 0; Level < OpenScopes.size(); ++Level)
+        Header += "$upscope $end\n";
+    Header += "$enddefinitions $end\n";
+    std::fwrite(Header.data(), 1, Header.size(), mpFile);
+
+    mHead = 0;
+    mTail = 0;
+    mCachedTail = 0;
+    mStop = false;
+    mWrittenTime = -1;
+    mText.clear();
+    mWriter = std::thread(&cWaveTracer::WriterLoop, this);
+
+    mRecording = false;
+    SetTime(mTime); // Starts recording now if the window is already open
+    return true;
+}
+//---
+void cWaveTracer::SetTime( long long aTime ) {
+    assert(aTime >= 0);
+    if (aTime < 0)
+        return; // A time record holds 63 bits; release builds keep the current time
+    mTime = aTime;
+    mTimePushed = false; // The time record is queued with the first change at this time
+
+    const bool Inside = mpFile != nullptr && aTime >= mWindowBegin && aTime < mWindowEnd;
+    if (Inside && !mRecording) {
+        mRecording = true;
+        RecordAll(); // The window starts with a full snapshot so the dump is self-contained
+    } else if (!Inside)
+        mRecording = false;
+}
+//---
+void cWaveTracer::RecordChange( int aSignal, cLogic::eLogicLevel aLevel ) {
+    if (!mRecording)
+        return;
+    if (!mTimePushed) {
+        Push(TimeFlag | static_cast<std::uint64_t>(mTime));
+        mTimePushed = true;
+    }
+    Push((static_cast<std::uint64_t>(aSignal) << 2) | EncodeLevel(aLevel));
+    ++mNumChanges;
+}
+//---
+void cWaveTracer::RecordAll() {
+    for (int s = 0; s < GetNumSignals(); ++s) {
+        const cSignal& Signal = mSignals[s];
+        RecordChange(s, Signal.mIsInput ? Signal.mpGate->mInputs[Signal.mPin] : Signal.mpGate->GetOutputState(Signal.mPin));
+    }
+}
+//---
+void cWaveTracer::Push( std::uint64_t aRecord ) {
+    const size_t Head = mHead.load(std::memory_order_relaxed);
+    if (Head - mCachedTail > mMask) {
+        mCachedTail = mTail.load(std::memory_order_acquire);
+        while (Head - mCachedTail > mMask) {
+            ++mNumStalls; // Ring full: wait for the writer rather than drop a change
+            std::this_thread::yield();
+            mCachedTail = mTail.load(std::memory_order_acquire);
+        }
+    }
+    mRing[Head & mMask] = aRecord;
+    mHead.store(Head + 1, std::memory_order_release);
+}
+//---
+void cWaveTracer::WriterLoop() {
+    size_t Tail = mTail.load(std::memory_order_relaxed);
+    for (;;) {
+        const size_t Head = mHead.load(std::memory_order_acquire);
+        if (Head == Tail) {
+            if (mStop.load(std::memory_order_acquire) && Tail == mHead.load(std::memory_order_acquire))
+                break;
+            std::this_thread::sleep_for(std::chrono::microseconds(100)); // Idle: no reason to spin
+            continue;
+        }
+
+        for (; Tail != Head; ++Tail) {
+            WriteRecord(mRing[Tail & mMask]);
+            if (mText.size() >= WriteChunkBytes) {
+                mTail.store(Tail + 1, std::memory_order_release); // Free the slots before blocking in fwrite
+                std::fwrite(mText.data(), 1, mText.size(), mpFile);
+                mText.clear();
+            }
+        }
+        mTail.store(Tail, std::memory_order_release);
+    }
+    std::fwrite(mText.data(), 1, mText.size(), mpFile);
+    mText.clear();
+}
+//---
+void cWaveTracer::WriteRecord( std::uint64_t aRecord ) {
+    if (aRecord & TimeFlag) {
+        mPendingTime = static_cast<long long>(aRecord & ~TimeFlag);
+        return;
+    }
+    if (mPendingTime != mWrittenTime) {
+        mText += '#';
+        mText += std::to_string(mPendingTime);
+        mText += '\n';
+        mWrittenTime = mPendingTime;
+    }
+    static const char Levels[3] = { '0', '1', 'x' };
+    mText += Levels[aRecord & 3];
+    mText += mIdCodes[aRecord >> 2];
+    mText += '\n';
+}
+//---
+void cWaveTracer::CloseFile() {
+    if (mpFile != nullptr) {
+        mStop.store(true, std::memory_order_release);
+        mWriter.join();
+        std::fclose(mpFile);
+        mpFile = nullptr;
+    }
+    mRecording = false;
+}
+//---
+void cWaveTracer::Close() {
+    CloseFile();
+    for (cTraceBinding& Binding : mBindings)
+        Binding.mpGate->mpTrace = nullptr;
+    mBindings.clear();
+    mSignals.clear();
+}
@@ -0,0 +1,131 @@
+// File: wave_trace.hpp
+// Author: Dylan George
+// Date Modified: 16th October 2026
+// Description: Header file for cWaveTracer, Value Change Dump (VCD) waveform tracing.
+
+#ifndef WAVE_TRACE_HPP
+#define WAVE_TRACE_HPP
+
+#include "logic_gates.hpp"
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <string>
+#include <thread>
+#include <vector>
+
+class cWaveTracer;
+
+// cTraceBinding: Signal ids of one traced gate's pins, -1 for a pin that is filtered out.
+// A gate points at its binding, so the untraced case costs one null check per change.
+class cTraceBinding {
+    public:
+        cWaveTracer* mpTracer;          // Tracer receiving the changes
+        cLogicGate* mpGate;             // Gate the signals belong to
+        std::vector<int> mInputs;       // Signal of each input (only the root circuit's inputs are traced)
+        std::vector<int> mOutputs;      // Signal of each output
+
+        inline void RecordInput( int aInputIndex, cLogic::eLogicLevel aLevel );
+        inline void RecordOutput( int aOutputIndex, cLogic::eLogicLevel aLevel );
+};
+
+
+// cWaveTracer writes the value changes of a circuit, its subcircuits and their gates to a
+// VCD file. The simulation thread only appends 8-byte change records to a single-producer,
+// single-consumer ring; a writer thread formats them and writes the file through a large
+// buffer. When the ring is full the simulation waits for the writer rather than losing changes.
+//
+// Usage: Attach the circuits, optionally AddFilter/SetWindow, Open, then call SetTime as
+// simulation time advances, and Close before the traced circuits are destroyed.
+// Times are non-negative and start at 0; the top bit of a ring record marks a time record.
+// Signals are named scope.child.pin, e.g. "adder.fa1.ha2.xor.out0"; children are found
+// through cLogicGate::ForEachChild. Gates answered from the truth-table cache do not
+// evaluate their children, so those children's traces hold their last simulated values.
+class cWaveTracer {
+    public:
+        static const size_t DefaultRingEntries = 1 << 16;
+
+        explicit cWaveTracer( size_t aRingEntries = DefaultRingEntries ); // Ring size is rounded up to a power of two
+        ~cWaveTracer(); // Closes the trace
+        cWaveTracer( const cWaveTracer& ) = delete;            // Gates point at the bindings
+        cWaveTracer& operator=( const cWaveTracer& ) = delete;
+
+        void AddFilter( const std::string& aPattern ); // Trace only signals matching one of the patterns ('*' and '?' wildcards)
+        void SetWindow( long long aBegin, long long aEnd ); // Record only times in [aBegin, aEnd); a negative aBegin means 0
+        int Attach( cLogicGate& aCircuit, const std::string& aName ); // Traces a circuit and everything below it; returns the signals added
+
+        bool Open( const char* apPath, const char* apTimescale = "1ns" ); // Writes the header and starts the writer; false if the file cannot be created
+        void SetTime( long long aTime ); // Later changes happen at aTime (must not decrease; negative times are ignored)
+        void Close(); // Drains the ring, finishes the file and detaches every gate
+
+        int GetNumSignals() const { return static_cast<int>(mSignals.size()); } // Signals attached (none after Close)
+        long long GetNumChanges() const { return mNumChanges; } // Change records produced while recording
+        long long GetNumStalls() const { return mNumStalls; }   // Times the simulation waited for the writer
+
+    private:
+        // cSignal: One traced pin
+        class cSignal {
+            public:
+                std::string mScope;     // Dotted scope the pin belongs to
+                std::string mName;      // Pin name within the scope
+                cLogicGate* mpGate;     // Gate owning the pin
+                int mPin;               // Pin index
+                bool mIsInput;          // Input pin rather than output
+        };
+
+        static const std::uint64_t TimeFlag = std::uint64_t(1) << 63; // Record holds a time, not a change
+
+        void AttachGate( cLogicGate& aGate, const std::string& aScope, bool aIsRoot ); // Adds the gate's pins, then its children
+        bool IsSelected( const std::string& aName ) const; // Passes the filters
+        void Push( std::uint64_t aRecord ); // Appends to the ring, waiting if it is full
+        void RecordChange( int aSignal, cLogic::eLogicLevel aLevel ); // Queues a change if inside the window
+        void RecordAll(); // Queues every signal's current value (entering the window)
+        void WriterLoop(); // Body of the writer thread
+        void CloseFile(); // Stops the writer and closes the file, leaving the gates attached
+        void WriteRecord( std::uint64_t aRecord ); // Formats one record into mText
+        std::string GetIdCode( int aSignal ) const; // Short VCD identifier of a signal
+
+        std::deque<cTraceBinding> mBindings;    // One per traced gate; addresses are stable
+        std::vector<cSignal> mSignals;          // Every traced pin, by signal id
+        std::vector<std::string> mFilters;      // Patterns a signal must match (all pass when empty)
+        long long mWindowBegin;                 // First time recorded
+        long long mWindowEnd;                   // First time no longer recorded
+        long long mTime;                        // Current simulation time
+        bool mRecording;                        // mTime is inside the window and the trace is open
+        bool mTimePushed;                       // A time record for mTime is already queued
+
+        // Ring shared with the writer; the indices only ever grow and are masked on access
+        std::vector<std::uint64_t> mRing;
+        size_t mMask;                                   // Ring size - 1
+        alignas(64) std::atomic<size_t> mHead;          // Next slot the simulation writes
+        alignas(64) std::atomic<size_t> mTail;          // Next slot the writer reads
+        alignas(64) size_t mCachedTail;                 // Simulation's last view of mTail
+        std::atomic<bool> mStop;                        // Writer should drain and exit
+        long long mNumChanges;                          // See GetNumChanges
+        long long mNumStalls;                           // See GetNumStalls
+
+        // Writer-side state
+        std::thread mWriter;            // Formats and writes records
+        std::FILE* mpFile;              // Output file while open
+        std::string mText;              // Formatted text waiting to be written
+        long long mPendingTime;         // Time of the most recent time record
+        long long mWrittenTime;         // Last time written as "#t" (-1 before the first)
+        std::vector<std::string> mIdCodes; // Identifier of each signal
+
+        friend class cTraceBinding;
+};
+
+
+//---cTraceBinding inline members----------------------------------------------
+void cTraceBinding::RecordInput( int aInputIndex, cLogic::eLogicLevel aLevel ) {
+    if (aInputIndex < static_cast<int>(mInputs.size()) && mInputs[aInputIndex] >= 0)
+        mpTracer->RecordChange(mInputs[aInputIndex], aLevel);
+}
+//---
+void cTraceBinding::RecordOutput( int aOutputIndex, cLogic::eLogicLevel aLevel ) {
+    if (mOutputs[aOutputIndex] >= 0)
+        mpTracer->RecordChange(mOutputs[aOutputIndex], aLevel);
+}
+
+#endif // WAVE_TRACE_HPP